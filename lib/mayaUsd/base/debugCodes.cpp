@@ -30,6 +30,8 @@ TF_REGISTRY_FUNCTION(TfDebug)
         USDMAYA_PROXYACCESSOR, "Debugging of the evaluation for mixed data models.");
     TF_DEBUG_ENVIRONMENT_SYMBOL(
         USDMAYA_PLUG_INFO_VERSION, "Debugging of the mayaUsd plug info version check.");
+    TF_DEBUG_ENVIRONMENT_SYMBOL(
+        USDMAYA_LAYER_SERIALIZATION, "Size and timing of the layers serialized to the Maya file.");
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
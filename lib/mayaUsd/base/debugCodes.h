@@ -27,7 +27,8 @@ TF_DEBUG_CODES(
     PXRUSDMAYA_TRANSLATORS,
     USDMAYA_PROXYSHAPEBASE,
     USDMAYA_PROXYACCESSOR,
-    USDMAYA_PLUG_INFO_VERSION);
+    USDMAYA_PLUG_INFO_VERSION,
+    USDMAYA_LAYER_SERIALIZATION);
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
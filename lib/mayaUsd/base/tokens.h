@@ -62,11 +62,23 @@ PXR_NAMESPACE_OPEN_SCOPE
     ((SerializedUsdEditsLocation, "mayaUsd_SerializedUsdEditsLocation")) \
     /* optionVar to force a prompt on every save                    */ \
     ((SerializedUsdEditsLocationPrompt, "mayaUsd_SerializedUsdEditsLocationPrompt")) \
+    /* optionVar to serialize the Usd edits saved to the Maya file   */ \
+    /* as LZ4 compressed binary crate data instead of text.         */ \
+    ((SerializedUsdEditsBinary, "mayaUsd_SerializedUsdEditsBinary")) \
     /* optionVar to control if comfirmation dialog will be show when overriding file */ \
     ((ConfirmExistingFileSave, "mayaUsd_ConfirmExistingFileSave"))     \
     /* optionVar to turn on or off async texture loading            */ \
     /* Notice that only newly opened USD stage would be affected.   */ \
     ((DisableAsyncTextureLoading, "mayaUsd_DisableAsyncTextureLoading")) \
+    /* optionVar to cap the resolution of viewport textures, in    */ \
+    /* pixels. Textures on selected prims are progressively loaded  */ \
+    /* at full resolution. 0 or unset means no cap.                 */ \
+    ((MaxTextureResolution, "mayaUsd_MaxTextureResolution")) \
+    /* optionVar for the memory budget of viewport textures, in MB. */ \
+    /* Full resolution textures are downgraded to the capped        */ \
+    /* resolution when the budget is exceeded. 0 or unset means no  */ \
+    /* budget.                                                      */ \
+    ((TextureMemoryBudget, "mayaUsd_TextureMemoryBudget")) \
     /* option var to remember if the stage in the layer editor is pinned. */ \
     ((PinLayerEditorStage, "mayaUsd_PinLayerEditorStage"))
 // clang-format on
@@ -146,6 +146,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kExportSkelsFlag, UsdMayaJobExportArgsTokens->exportSkels.GetText(), MSyntax::kString);
     syntax.addFlag(
         kExportSkinFlag, UsdMayaJobExportArgsTokens->exportSkin.GetText(), MSyntax::kString);
+    syntax.addFlag(
+        kMaxJointInfluencesFlag,
+        UsdMayaJobExportArgsTokens->maxJointInfluences.GetText(),
+        MSyntax::kLong);
     syntax.addFlag(
         kExportBlendShapesFlag,
         UsdMayaJobExportArgsTokens->exportBlendShapes.GetText(),
@@ -207,6 +211,10 @@ MSyntax MayaUSDExportCommand::createSyntax()
         kStaticSingleSample,
         UsdMayaJobExportArgsTokens->staticSingleSample.GetText(),
         MSyntax::kBoolean);
+    syntax.addFlag(
+        kContextEvaluation,
+        UsdMayaJobExportArgsTokens->contextEvaluation.GetText(),
+        MSyntax::kBoolean);
     syntax.addFlag(
         kGeomSidednessFlag, UsdMayaJobExportArgsTokens->geomSidedness.GetText(), MSyntax::kString);
 
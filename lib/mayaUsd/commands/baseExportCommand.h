@@ -70,6 +70,7 @@ public:
     static constexpr auto kExportRootsFlag = "ert";
     static constexpr auto kExportSkelsFlag = "skl";
     static constexpr auto kExportSkinFlag = "skn";
+    static constexpr auto kMaxJointInfluencesFlag = "mji";
     static constexpr auto kExportBlendShapesFlag = "ebs";
     static constexpr auto kParentScopeFlag = "psc";
     static constexpr auto kRenderableOnlyFlag = "ro";
@@ -86,6 +87,7 @@ public:
     static constexpr auto kPythonPostCallbackFlag = "ppc";
     static constexpr auto kVerboseFlag = "v";
     static constexpr auto kStaticSingleSample = "sss";
+    static constexpr auto kContextEvaluation = "cev";
     static constexpr auto kGeomSidednessFlag = "gs";
     static constexpr auto kApiSchemaFlag = "api";
     static constexpr auto kJobContextFlag = "jc";
@@ -78,6 +78,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (exportRoots) \
     (exportSkels) \
     (exportSkin) \
+    (maxJointInfluences) \
     (exportUVs) \
     (exportVisibility) \
     (jobContext) \
@@ -105,6 +106,7 @@ TF_DECLARE_PUBLIC_TOKENS(
     (stripNamespaces) \
     (verbose) \
     (staticSingleSample) \
+    (contextEvaluation) \
     (geomSidedness)   \
     (worldspace) \
     (writeDefaults) \
@@ -192,6 +194,9 @@ struct UsdMayaJobExportArgs
     const bool        exportRefsAsInstanceable;
     const TfToken     exportSkels;
     const TfToken     exportSkin;
+    /// The most joint influences written per point, or zero to write all
+    /// the non-zero influences.
+    const int         maxJointInfluences;
     const bool        exportBlendShapes;
     const bool        exportVisibility;
     const bool        exportComponentTags;
@@ -229,6 +234,9 @@ struct UsdMayaJobExportArgs
     const TfToken::Set allMaterialConversions;
     const bool         verbose;
     const bool         staticSingleSample;
+    /// Evaluate time samples through an MDGContext instead of changing the
+    /// current time. See UsdMaya_WriteJob::Write for when this applies.
+    const bool         contextEvaluation;
     const TfToken      geomSidedness;
     const TfToken::Set includeAPINames;
     const TfToken::Set jobContextNames;
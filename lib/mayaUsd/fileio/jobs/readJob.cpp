@@ -19,6 +19,7 @@
 #include <mayaUsd/fileio/primReaderRegistry.h>
 #include <mayaUsd/fileio/translators/translatorMaterial.h>
 #include <mayaUsd/fileio/translators/translatorXformable.h>
+#include <mayaUsd/fileio/utils/meshReadUtils.h>
 #include <mayaUsd/fileio/utils/readUtil.h>
 #include <mayaUsd/nodes/stageNode.h>
 #include <mayaUsd/undo/OpUndoItemMuting.h>
@@ -29,6 +30,8 @@
 
 #include <pxr/base/tf/debug.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/sdf/fileFormat.h>
 #include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/path.h>
@@ -41,6 +44,7 @@
 #include <pxr/usd/usd/timeCode.h>
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usd/zipFile.h>
+#include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/metrics.h>
 #include <pxr/usd/usdGeom/xform.h>
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
@@ -70,6 +74,10 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
+// Maximum number of meshes whose USD data is read ahead of the prim being imported, to bound the
+// memory held by the read ahead data.
+constexpr size_t kMeshReadAheadSize = 256;
+
 // Simple RAII class to ensure tracking does not extend past the scope.
 struct TempNodeTrackerScope
 {
@@ -188,6 +196,7 @@ UsdMaya_ReadJob::UsdMaya_ReadJob(
     , mMayaRootDagPath()
     , mDagModifierUndo()
     , mDagModifierSeeded(false)
+    , mReadMeshDataAhead(true)
 {
 }
 
@@ -606,6 +615,7 @@ void UsdMaya_ReadJob::_ImportPrototype(
 {
     _PrimReaderMap     primReaderMap;
     const UsdPrimRange range = UsdPrimRange::PreAndPostVisit(prototype);
+    UsdMayaPrimReaderContext::MeshReadDataMap meshReadData;
     for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
         const UsdPrim&           prim = *primIt;
         UsdMayaPrimReaderContext readCtx(&mNewNodeRegistry);
@@ -613,7 +623,76 @@ void UsdMaya_ReadJob::_ImportPrototype(
         if (prim.IsInstance()) {
             _DoImportInstanceIt(primIt, usdRootPrim, readCtx, primReaderMap);
         } else {
+            _ReadMeshDataAhead(primIt, range, &meshReadData);
+            readCtx.SetMeshReadData(&meshReadData);
             _DoImportPrimIt(primIt, usdRootPrim, readCtx, primReaderMap);
+            _DropUnusedMeshData(primIt, readCtx, &meshReadData);
+        }
+    }
+}
+
+void UsdMaya_ReadJob::_ReadMeshDataAhead(
+    const UsdPrimRange::iterator&              primIt,
+    const UsdPrimRange&                        range,
+    UsdMayaPrimReaderContext::MeshReadDataMap* meshReadData)
+{
+    if (!mReadMeshDataAhead || primIt.IsPostVisit() || !primIt->IsA<UsdGeomMesh>()
+        || meshReadData->count(primIt->GetPath())) {
+        return;
+    }
+
+    TRACE_FUNCTION();
+
+    // The data left over was read for meshes that were skipped, for example by a prim reader
+    // pruning their parent, so it will never be used.
+    meshReadData->clear();
+
+    std::vector<UsdGeomMesh> meshes;
+    for (auto it = primIt; it != range.end() && meshes.size() < kMeshReadAheadSize; ++it) {
+        if (!it.IsPostVisit() && it->IsA<UsdGeomMesh>()) {
+            meshes.emplace_back(*it);
+        }
+    }
+
+    std::vector<UsdMayaMeshReadData> data(meshes.size());
+    WorkParallelForN(meshes.size(), [this, &meshes, &data](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            UsdMayaMeshReadUtils::readMeshData(meshes[i], mArgs.timeInterval, &data[i]);
+        }
+    });
+
+    meshReadData->reserve(meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        meshReadData->emplace(meshes[i].GetPath(), std::move(data[i]));
+    }
+}
+
+void UsdMaya_ReadJob::_DropUnusedMeshData(
+    const UsdPrimRange::iterator&              primIt,
+    const UsdMayaPrimReaderContext&            readCtx,
+    UsdMayaPrimReaderContext::MeshReadDataMap* meshReadData)
+{
+    if (primIt.IsPostVisit() || meshReadData->empty()) {
+        return;
+    }
+
+    const SdfPath& path = primIt->GetPath();
+    auto           it = meshReadData->find(path);
+    if (it != meshReadData->end()) {
+        // The mesh was not read by the default mesh reader, so the meshes are not read ahead
+        // anymore for the rest of the import.
+        meshReadData->clear();
+        mReadMeshDataAhead = false;
+        return;
+    }
+
+    if (readCtx.GetPruneChildren()) {
+        for (it = meshReadData->begin(); it != meshReadData->end();) {
+            if (it->first.HasPrefix(path)) {
+                it = meshReadData->erase(it);
+            } else {
+                ++it;
+            }
         }
     }
 }
@@ -621,6 +700,7 @@ void UsdMaya_ReadJob::_ImportPrototype(
 bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootPrim)
 {
     const bool buildInstances = mArgs.importInstances;
+    mReadMeshDataAhead = true;
 
     MayaUsd::ProgressBarScope progressBar(0);
 
@@ -637,6 +717,10 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
             : UsdPrimRange::PreAndPostVisit(
                 rootPrim, UsdTraverseInstanceProxies(UsdPrimAllPrimsPredicate));
 
+        // The USD data of the meshes is read in parallel ahead of the prims being imported,
+        // since the Maya nodes can only be created on the main thread.
+        UsdMayaPrimReaderContext::MeshReadDataMap meshReadData;
+
         const int                     loopSize = std::distance(range.begin(), range.end());
         MayaUsd::ProgressBarLoopScope instanceLoop(loopSize);
         for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
@@ -647,7 +731,10 @@ bool UsdMaya_ReadJob::_DoImport(UsdPrimRange& rootRange, const UsdPrim& usdRootP
             if (buildInstances && prim.IsInstance()) {
                 _DoImportInstanceIt(primIt, usdRootPrim, readCtx, primReaderMap);
             } else {
+                _ReadMeshDataAhead(primIt, range, &meshReadData);
+                readCtx.SetMeshReadData(&meshReadData);
                 _DoImportPrimIt(primIt, usdRootPrim, readCtx, primReaderMap);
+                _DropUnusedMeshData(primIt, readCtx, &meshReadData);
             }
             instanceLoop.loopAdvance();
         }
@@ -129,12 +129,27 @@ private:
         const UsdPrim&            usdRootPrim,
         UsdMayaPrimReaderContext& readCtx);
 
+    // Reads the USD data of a bounded number of the meshes starting at primIt, in parallel, for
+    // their prim readers, when primIt is a mesh whose data was not read yet.
+    void _ReadMeshDataAhead(
+        const UsdPrimRange::iterator&              primIt,
+        const UsdPrimRange&                        range,
+        UsdMayaPrimReaderContext::MeshReadDataMap* meshReadData);
+
+    // Drops the mesh data read ahead that will not be used once primIt is imported: the data of
+    // the meshes under pruned prims, or of a mesh that its prim reader did not take.
+    void _DropUnusedMeshData(
+        const UsdPrimRange::iterator&              primIt,
+        const UsdMayaPrimReaderContext&            readCtx,
+        UsdMayaPrimReaderContext::MeshReadDataMap* meshReadData);
+
     double _setTimeSampleMultiplierFrom(const double layerFPS);
 
     // Data
     MDagModifier mDagModifierUndo;
     bool         mDagModifierSeeded;
     double       mTimeSampleMultiplier;
+    bool         mReadMeshDataAhead;
 
     /// Cache of import chasers that were run. Currently used to aid in redo/undo operations
     /// This cache is cleared for every new Read() operation.
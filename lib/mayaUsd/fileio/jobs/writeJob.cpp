@@ -29,6 +29,8 @@
 
 #include <maya/MAnimControl.h>
 #include <maya/MComputation.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MDistance.h>
 #include <maya/MFnDagNode.h>
 #include <maya/MFnRenderLayer.h>
@@ -132,17 +134,37 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
     if (!timeSamples.empty()) {
         const MTime oldCurTime = MAnimControl::currentTime();
 
+        // Evaluating each frame through a context leaves the current time untouched, which
+        // avoids refreshing the scene and running time-change callbacks for every frame.
+        // Chasers and per-frame callbacks may query the scene with commands that only see the
+        // current time, so they keep the time-changing path.
+        const bool useContextEvaluation = mJobCtx.mArgs.contextEvaluation && mChasers.empty()
+            && mJobCtx.mArgs.melPerFrameCallback.empty()
+            && mJobCtx.mArgs.pythonPerFrameCallback.empty();
+
         for (double t : timeSamples) {
             if (mJobCtx.mArgs.verbose) {
                 TF_STATUS("%f", t);
             }
-            MGlobal::viewFrame(t);
-            progressBar.advance();
 
-            // Process per frame data.
-            if (!_WriteFrame(t)) {
-                MGlobal::viewFrame(oldCurTime);
-                return false;
+            if (useContextEvaluation) {
+                progressBar.advance();
+
+                const MDGContext frameContext(MTime(t, MTime::uiUnit()));
+                MDGContextGuard  contextGuard(frameContext);
+
+                if (!_WriteFrame(t)) {
+                    return false;
+                }
+            } else {
+                MGlobal::viewFrame(t);
+                progressBar.advance();
+
+                // Process per frame data.
+                if (!_WriteFrame(t)) {
+                    MGlobal::viewFrame(oldCurTime);
+                    return false;
+                }
             }
 
             // Allow user cancellation.
@@ -152,7 +174,9 @@ bool UsdMaya_WriteJob::Write(const std::string& fileName, bool append)
         }
 
         // Set the time back.
-        MGlobal::viewFrame(oldCurTime);
+        if (!useContextEvaluation) {
+            MGlobal::viewFrame(oldCurTime);
+        }
     }
 
     // Finalize the export, close the stage.
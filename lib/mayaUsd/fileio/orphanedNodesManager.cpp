@@ -20,6 +20,7 @@
 #include <mayaUsd/nodes/proxyShapeBase.h>
 #include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/ufe/Utils.h>
+#include <mayaUsd/utils/trieVisitor.h>
 
 #include <usdUfe/ufe/UsdSceneItem.h>
 
@@ -30,7 +31,9 @@
 #include <maya/MPlug.h>
 #include <ufe/hierarchy.h>
 #include <ufe/sceneSegmentHandler.h>
-#include <ufe/trie.imp.h>
+
+#include <utility>
+#include <vector>
 
 // For Tf diagnostics macros.
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -62,11 +65,223 @@ OrphanedNodesManager::Memento& OrphanedNodesManager::Memento::operator=(Memento&
     return *this;
 }
 
-Ufe::Trie<OrphanedNodesManager::PullVariantInfo> OrphanedNodesManager::Memento::release()
+OrphanedNodesManager::PulledPrims OrphanedNodesManager::Memento::release()
 {
     return std::move(_pulledPrims);
 }
 
+//------------------------------------------------------------------------------
+// Class OrphanedNodesManager::PulledPrims
+//------------------------------------------------------------------------------
+
+namespace {
+
+using TrieNode = OrphanedNodesManager::PulledPrims::Node;
+
+// Return the node held by the argument pointer, first replacing it with a
+// copy if it is shared.  The copy shares the children of the original.
+TrieNode* makeExclusive(std::shared_ptr<TrieNode>& node)
+{
+    if (node.use_count() > 1)
+        node = std::make_shared<TrieNode>(*node);
+    return node.get();
+}
+
+} // namespace
+
+std::vector<Ufe::PathComponent> OrphanedNodesManager::PulledPrims::Node::childrenComponents() const
+{
+    std::vector<Ufe::PathComponent> components;
+    components.reserve(_children.size());
+    for (const auto& child : _children)
+        components.push_back(child.first);
+    return components;
+}
+
+OrphanedNodesManager::PulledPrims::Node::Ptr
+OrphanedNodesManager::PulledPrims::Node::operator[](const Ufe::PathComponent& component) const
+{
+    const auto found = _children.find(component);
+    if (found == _children.end())
+        return nullptr;
+    return found->second;
+}
+
+OrphanedNodesManager::PulledPrims::PulledPrims()
+    : _root(std::make_shared<Node>())
+{
+}
+
+OrphanedNodesManager::PulledPrims::Node::Ptr
+OrphanedNodesManager::PulledPrims::node(const Ufe::Path& path) const
+{
+    Node::Ptr trieNode = _root;
+    for (const auto& c : path) {
+        trieNode = (*trieNode)[c];
+        if (!trieNode)
+            return nullptr;
+    }
+    return trieNode;
+}
+
+OrphanedNodesManager::PulledPrims::Node::Ptr
+OrphanedNodesManager::PulledPrims::find(const Ufe::Path& path) const
+{
+    Node::Ptr trieNode = node(path);
+    if (!trieNode || !trieNode->hasData())
+        return nullptr;
+    return trieNode;
+}
+
+bool OrphanedNodesManager::PulledPrims::containsDescendant(const Ufe::Path& path) const
+{
+    const Node::Ptr trieNode = node(path);
+    return trieNode && trieNode->nbPulled() > (trieNode->hasData() ? 1u : 0u);
+}
+
+bool OrphanedNodesManager::PulledPrims::containsDescendantInclusive(const Ufe::Path& path) const
+{
+    const Node::Ptr trieNode = node(path);
+    return trieNode && trieNode->nbPulled() > 0;
+}
+
+void OrphanedNodesManager::PulledPrims::add(
+    const Ufe::Path&       path,
+    const PullVariantInfo& info,
+    bool                   orphaned)
+{
+    const std::vector<Node*> nodes = exclusiveNodes(path);
+    Node*                    trieNode = nodes.back();
+
+    const std::ptrdiff_t pulled = trieNode->_hasData ? 0 : 1;
+    const std::ptrdiff_t wasOrphaned = (trieNode->_hasData && trieNode->_orphaned) ? 1 : 0;
+
+    trieNode->_data = info;
+    trieNode->_hasData = true;
+    trieNode->_orphaned = orphaned;
+
+    adjustCounts(nodes, pulled, (orphaned ? 1 : 0) - wasOrphaned);
+}
+
+bool OrphanedNodesManager::PulledPrims::remove(const Ufe::Path& path)
+{
+    if (!find(path))
+        return false;
+
+    detach(path);
+    return true;
+}
+
+bool OrphanedNodesManager::PulledPrims::move(const Ufe::Path& oldPath, const Ufe::Path& newPath)
+{
+    std::shared_ptr<Node> subtree = detach(oldPath);
+    if (!subtree)
+        return false;
+
+    // On rename, only the root of the subtree changes.
+    if (subtree->_component != newPath.back())
+        makeExclusive(subtree)->_component = newPath.back();
+
+    const std::vector<Node*> parents = exclusiveNodes(newPath.pop());
+    std::shared_ptr<Node>&   slot = parents.back()->_children[newPath.back()];
+
+    std::ptrdiff_t pulled = subtree->_nbPulled;
+    std::ptrdiff_t orphaned = subtree->_nbOrphaned;
+    if (slot) {
+        pulled -= slot->_nbPulled;
+        orphaned -= slot->_nbOrphaned;
+    }
+    slot = std::move(subtree);
+
+    adjustCounts(parents, pulled, orphaned);
+    return true;
+}
+
+bool OrphanedNodesManager::PulledPrims::setData(const Ufe::Path& path, const PullVariantInfo& info)
+{
+    if (!find(path))
+        return false;
+
+    exclusiveNodes(path).back()->_data = info;
+    return true;
+}
+
+bool OrphanedNodesManager::PulledPrims::setOrphaned(const Ufe::Path& path, bool orphaned)
+{
+    {
+        const Node::Ptr trieNode = find(path);
+        if (!trieNode)
+            return false;
+        if (trieNode->isOrphaned() == orphaned)
+            return true;
+    }
+
+    const std::vector<Node*> nodes = exclusiveNodes(path);
+    nodes.back()->_orphaned = orphaned;
+    adjustCounts(nodes, 0, orphaned ? 1 : -1);
+    return true;
+}
+
+void OrphanedNodesManager::PulledPrims::clear() { _root = std::make_shared<Node>(); }
+
+std::vector<OrphanedNodesManager::PulledPrims::Node*>
+OrphanedNodesManager::PulledPrims::exclusiveNodes(const Ufe::Path& path)
+{
+    // Once a node has been copied, its children are shared with the original
+    // and are copied in turn, so the whole path ends up exclusively owned.
+    std::vector<Node*> nodes;
+    nodes.reserve(path.size() + 1);
+    nodes.push_back(makeExclusive(_root));
+    for (const auto& c : path) {
+        auto& children = nodes.back()->_children;
+        auto  found = children.find(c);
+        if (found == children.end())
+            found = children.emplace(c, std::make_shared<Node>(c)).first;
+        nodes.push_back(makeExclusive(found->second));
+    }
+    return nodes;
+}
+
+std::shared_ptr<OrphanedNodesManager::PulledPrims::Node>
+OrphanedNodesManager::PulledPrims::detach(const Ufe::Path& path)
+{
+    if (path.empty() || !node(path))
+        return nullptr;
+
+    const std::vector<Node*> parents = exclusiveNodes(path.pop());
+
+    auto&                 siblings = parents.back()->_children;
+    const auto            found = siblings.find(path.back());
+    std::shared_ptr<Node> detached = std::move(found->second);
+    siblings.erase(found);
+
+    adjustCounts(
+        parents, -std::ptrdiff_t(detached->_nbPulled), -std::ptrdiff_t(detached->_nbOrphaned));
+
+    // Remove the ancestors left empty, but never the root.
+    for (size_t i = parents.size() - 1; i > 0; --i) {
+        const Node* parent = parents[i];
+        if (parent->_hasData || !parent->_children.empty())
+            break;
+        const Ufe::PathComponent component = parent->_component;
+        parents[i - 1]->_children.erase(component);
+    }
+
+    return detached;
+}
+
+/* static */
+void OrphanedNodesManager::PulledPrims::adjustCounts(
+    const std::vector<Node*>& nodes,
+    std::ptrdiff_t            pulled,
+    std::ptrdiff_t            orphaned)
+{
+    for (Node* trieNode : nodes) {
+        trieNode->_nbPulled = size_t(std::ptrdiff_t(trieNode->_nbPulled) + pulled);
+        trieNode->_nbOrphaned = size_t(std::ptrdiff_t(trieNode->_nbOrphaned) + orphaned);
+    }
+}
+
 //------------------------------------------------------------------------------
 // Class OrphanedNodesManager
 //------------------------------------------------------------------------------
@@ -77,10 +292,10 @@ using PullVariantInfo = OrphanedNodesManager::PullVariantInfo;
 using VariantSetDescriptor = OrphanedNodesManager::VariantSetDescriptor;
 using VariantSelection = OrphanedNodesManager::VariantSelection;
 using PulledPrims = OrphanedNodesManager::PulledPrims;
-using PulledPrimNode = Ufe::TrieNode<PullVariantInfo>;
+using PulledPrimNode = OrphanedNodesManager::PulledPrimNode;
 
-Ufe::PathSegment::Components trieNodeToPathComponents(PulledPrimNode::Ptr trieNode);
-Ufe::Path                    trieNodeToPulledPrimUfePath(PulledPrimNode::Ptr trieNode);
+Ufe::PathSegment::Components triePathToPathComponents(const Ufe::Path& triePath);
+Ufe::Path                    triePathToPulledPrimUfePath(const Ufe::Path& triePath);
 
 void renameVariantDescriptors(
     std::list<VariantSetDescriptor>& descriptors,
@@ -96,23 +311,26 @@ void renameVariantDescriptors(
 }
 
 void renameVariantInfo(
-    const PulledPrimNode::Ptr& trieNode,
-    const Ufe::Path&           oldPath,
-    const Ufe::Path&           newPath)
+    PulledPrims&           pulledPrims,
+    const Ufe::Path&       triePath,
+    const PullVariantInfo& variantInfo,
+    const Ufe::Path&       oldPath,
+    const Ufe::Path&       newPath)
 {
-    // Note: TrieNode has no non-const data() function, so to modify the
-    //       data we must make a copy, modify the copy and call setData().
-    PullVariantInfo newVariantInfo = trieNode->data();
+    // Note: trie nodes are shared with the mementos, so to modify the data
+    //       we must make a copy, modify the copy and call setData().
+    PullVariantInfo newVariantInfo = variantInfo;
 
     renameVariantDescriptors(newVariantInfo.variantSetDescriptors, oldPath, newPath);
 
-    trieNode->setData(newVariantInfo);
+    pulledPrims.setData(triePath, newVariantInfo);
 }
 
 void renamePullInformation(
-    const PulledPrimNode::Ptr& trieNode,
-    const Ufe::Path&           oldPath,
-    const Ufe::Path&           newPath)
+    const Ufe::Path&       triePath,
+    const PullVariantInfo& variantInfo,
+    const Ufe::Path&       oldPath,
+    const Ufe::Path&       newPath)
 {
     // Note: the trie only contains UFE path components, no UFE segments.
     //       So we can't build a correct UFE path with the correct run-time ID
@@ -131,7 +349,7 @@ void renamePullInformation(
     //       between the Maya run-time and the USD run-time.
     Ufe::Path pulledPath = newPath;
 
-    const Ufe::PathSegment::Components pathComponents = trieNodeToPathComponents(trieNode);
+    const Ufe::PathSegment::Components pathComponents = triePathToPathComponents(triePath);
     for (size_t i = newPath.size(); i < pathComponents.size(); ++i) {
         const Ufe::PathComponent& comp = pathComponents[i];
         if (pulledPath.nbSegments() < 2) {
@@ -141,22 +359,27 @@ void renamePullInformation(
         }
     }
 
-    const MDagPath& mayaPath = trieNode->data().editedAsMayaRoot;
+    const MDagPath& mayaPath = variantInfo.editedAsMayaRoot;
     TF_VERIFY(writePullInformation(pulledPath, mayaPath));
 }
 
 void recursiveRename(
-    const PulledPrimNode::Ptr& trieNode,
-    const Ufe::Path&           oldPath,
-    const Ufe::Path&           newPath)
+    PulledPrims&     pulledPrims,
+    const Ufe::Path& triePath,
+    const Ufe::Path& oldPath,
+    const Ufe::Path& newPath)
 {
+    const PulledPrimNode::Ptr trieNode = pulledPrims.node(triePath);
+    if (!trieNode)
+        return;
+
     if (trieNode->hasData()) {
-        renameVariantInfo(trieNode, oldPath, newPath);
-        renamePullInformation(trieNode, oldPath, newPath);
+        renameVariantInfo(pulledPrims, triePath, trieNode->data(), oldPath, newPath);
+        renamePullInformation(triePath, trieNode->data(), oldPath, newPath);
     } else {
         auto childrenComponents = trieNode->childrenComponents();
         for (auto& c : childrenComponents) {
-            recursiveRename((*trieNode)[c], oldPath, newPath);
+            recursiveRename(pulledPrims, triePath + c, oldPath, newPath);
         }
     }
 }
@@ -169,17 +392,12 @@ void handlePathChange(
     if (!item)
         return;
 
-    auto trieNode = pulledPrims.node(oldPath);
-    if (trieNode) {
+    if (pulledPrims.node(oldPath)) {
+        // Both renames and reparents move the subtree of the old path. On a
+        // rename, the nodes below the renamed one are not copied.
         const Ufe::Path& newPath = item->path();
-        // If the only change is the last part of the UFE path, then
-        // we are dealing with a rename. Else it is a reparent.
-        if (newPath.pop() == oldPath.pop()) {
-            trieNode->rename(newPath.back());
-        } else {
-            pulledPrims.move(oldPath, newPath);
-        }
-        recursiveRename(trieNode, oldPath, newPath);
+        pulledPrims.move(oldPath, newPath);
+        recursiveRename(pulledPrims, newPath, oldPath, newPath);
     }
 }
 
@@ -226,14 +444,14 @@ void OrphanedNodesManager::add(const Ufe::Path& pulledPath, const MDagPath& edit
 OrphanedNodesManager::Memento OrphanedNodesManager::remove(const Ufe::Path& pulledPath)
 {
     Memento oldPulledPrims(preserve());
-    TF_AXIOM(_pulledPrims.remove(pulledPath) != nullptr);
+    TF_AXIOM(_pulledPrims.remove(pulledPath));
     return oldPulledPrims;
 }
 
 const PullVariantInfo& OrphanedNodesManager::get(const Ufe::Path& pulledPath) const
 {
     const auto infoNode = _pulledPrims.find(pulledPath);
-    if (!infoNode || !infoNode->hasData()) {
+    if (!infoNode) {
         static const PullVariantInfo empty;
         return empty;
     }
@@ -297,9 +515,8 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         // descendants of the argument path that have all the proper variants.
         // The trie node that corresponds to the added path is the starting
         // point.  It may be an internal node, without data.
-        auto ancestorNode = _pulledPrims.node(op.path);
-        TF_VERIFY(ancestorNode);
-        recursiveSwitch(ancestorNode, op.path);
+        TF_VERIFY(_pulledPrims.node(op.path));
+        recursiveSwitch(op.path);
     } break;
     case Ufe::SceneCompositeNotification::OpType::ObjectDelete: {
         // The following cases will generate object delete:
@@ -316,9 +533,8 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
         // Traverse the trie, and hide pull parents that are descendants of
         // the argument path.  First, get the trie node that corresponds to
         // the path.  It may be an internal node, without data.
-        auto ancestorNode = _pulledPrims.node(op.path);
-        TF_VERIFY(ancestorNode);
-        recursiveSetOrphaned(ancestorNode, true);
+        TF_VERIFY(_pulledPrims.node(op.path));
+        recursiveSetOrphaned(op.path, true);
     } break;
     case Ufe::SceneCompositeNotification::OpType::SubtreeInvalidate: {
         // On subtree invalidate, the scene item itself has not had a structure
@@ -336,10 +552,7 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
 
         auto parentHier = Ufe::Hierarchy::hierarchy(parentItem);
         if (!parentHier->hasChildren()) {
-            auto ancestorNode = _pulledPrims.node(op.path);
-            if (ancestorNode) {
-                recursiveSetOrphaned(ancestorNode, true);
-            }
+            recursiveSetOrphaned(op.path, true);
             return;
         } else {
             // On variant switch, given a pulled prim, the session layer will
@@ -370,26 +583,22 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
                     + Ufe::PathSegment(
                           child.GetPath().GetAsString(), MayaUsd::ufe::getUsdRunTimeId(), '/');
 
-                auto ancestorNode = _pulledPrims.node(childPath);
                 // If there is no ancestor node in the trie, this means that
                 // the new hierarchy is completely different from the one when
                 // the pull occurred, which means that the pulled object must
                 // stay hidden.
-                if (!ancestorNode)
+                if (!_pulledPrims.node(childPath))
                     continue;
 
                 foundChild = true;
-                recursiveSwitch(ancestorNode, childPath);
+                recursiveSwitch(childPath);
             }
             if (!foundChild) {
                 // Following a subtree invalidate, if none of the now-valid
                 // children appear in the trie, means that we've switched to a
                 // different variant, and everything below that path should be
                 // hidden.
-                auto ancestorNode = _pulledPrims.node(op.path);
-                if (ancestorNode) {
-                    recursiveSetOrphaned(ancestorNode, true);
-                }
+                recursiveSetOrphaned(op.path, true);
             }
         }
     } break;
@@ -409,28 +618,55 @@ void OrphanedNodesManager::handleOp(const Ufe::SceneCompositeNotification::Op& o
 
 void OrphanedNodesManager::clear() { _pulledPrims.clear(); }
 
-bool OrphanedNodesManager::empty() const { return _pulledPrims.root()->empty(); }
+bool OrphanedNodesManager::empty() const { return _pulledPrims.empty(); }
 
 OrphanedNodesManager::Memento OrphanedNodesManager::preserve() const
 {
-    return Memento(deepCopy(_pulledPrims));
+    // The trie is persistent, so the copy only shares its root.
+    return Memento(PulledPrims(_pulledPrims));
 }
 
-void OrphanedNodesManager::restore(Memento&& previous) { _pulledPrims = previous.release(); }
+void OrphanedNodesManager::restore(Memento&& previous)
+{
+    _pulledPrims = previous.release();
+
+    // The orphaned flags of the trie can disagree with the visibility of the pull parents,
+    // for example when loaded from a file saved without them, and the flags decide which
+    // subtrees recursiveSetOrphaned() skips.  Synchronize them with the pull parents.
+    using PulledPrimNode = const OrphanedNodesManager::PulledPrimNode;
+
+    std::vector<std::pair<Ufe::Path, bool>> changedOrphaned;
+    TrieVisitor<PullVariantInfo, PulledPrimNode>::visit(
+        Ufe::Path(),
+        _pulledPrims.root(),
+        [&changedOrphaned](const Ufe::Path& path, PulledPrimNode& node) {
+            MDagPath pullParentPath = node.data().editedAsMayaRoot;
+            pullParentPath.pop();
+            if (!pullParentPath.isValid()) {
+                return;
+            }
+
+            MFnDagNode fn(pullParentPath);
+            auto       visibilityPlug = fn.findPlug("visibility", /* tryNetworked */ true);
+            const bool orphaned = !visibilityPlug.asBool();
+            if (orphaned != node.isOrphaned()) {
+                changedOrphaned.emplace_back(path, orphaned);
+            }
+        });
+
+    for (const auto& pathAndOrphaned : changedOrphaned) {
+        _pulledPrims.setOrphaned(pathAndOrphaned.first, pathAndOrphaned.second);
+    }
+}
 
 bool OrphanedNodesManager::isOrphaned(const Ufe::Path& pulledPath) const
 {
-    auto trieNode = _pulledPrims.node(pulledPath);
+    auto trieNode = _pulledPrims.find(pulledPath);
     if (!trieNode) {
         // If the argument path has not been pulled, it can't be orphaned.
         return false;
     }
 
-    if (!trieNode->hasData()) {
-        // If the argument path has not been pulled, it can't be orphaned.
-        return false;
-    }
-
     const PullVariantInfo& variantInfo = trieNode->data();
 
     // If the pull parent is visible, the pulled path is not orphaned.
@@ -442,33 +678,40 @@ bool OrphanedNodesManager::isOrphaned(const Ufe::Path& pulledPath) const
     return !visibilityPlug.asBool();
 }
 
+size_t OrphanedNodesManager::nbPulled(const Ufe::Path& path) const
+{
+    const auto trieNode = _pulledPrims.node(path);
+    return trieNode ? trieNode->nbPulled() : 0;
+}
+
+size_t OrphanedNodesManager::nbOrphaned(const Ufe::Path& path) const
+{
+    const auto trieNode = _pulledPrims.node(path);
+    return trieNode ? trieNode->nbOrphaned() : 0;
+}
+
 namespace {
 
-Ufe::PathSegment::Components trieNodeToPathComponents(PulledPrimNode::Ptr trieNode)
+Ufe::PathSegment::Components triePathToPathComponents(const Ufe::Path& triePath)
 {
-    // Accumulate all UFE path components, in reverse order. We then reverse
-    // the order to get the true path order.
-    //
-    // Note: the trie root node is not really part of the hierarchy, so do not
-    //       include it in the components. We detect we are at the root when
-    //       the node has no parent.
+    // The trie is keyed by the UFE path components, regardless of the
+    // segments they belong to, so the segments of the path do not matter.
     Ufe::PathSegment::Components pathComponents;
-    while (trieNode->parent()) {
-        pathComponents.push_back(trieNode->component());
-        trieNode = trieNode->parent();
+    pathComponents.reserve(triePath.size());
+    for (const auto& comp : triePath) {
+        pathComponents.push_back(comp);
     }
-    std::reverse(pathComponents.begin(), pathComponents.end());
     return pathComponents;
 }
 
-Ufe::Path trieNodeToPulledPrimUfePath(PulledPrimNode::Ptr trieNode)
+Ufe::Path triePathToPulledPrimUfePath(const Ufe::Path& triePath)
 {
     // We assume the prim path is comosed of two segments: one in Maya, up to the
     // stage proxy shape, then in USD.
     Ufe::Path primPath;
     bool      foundStage = false;
 
-    const Ufe::PathSegment::Components pathComponents = trieNodeToPathComponents(trieNode);
+    const Ufe::PathSegment::Components pathComponents = triePathToPathComponents(triePath);
     for (const Ufe::PathComponent& comp : pathComponents) {
         // If the path is empty, it means we are starting the Maya path, so create
         // a Maya UFE segment.
@@ -511,10 +754,12 @@ MStatus setNodeVisibility(const MDagPath& dagPath, bool visibility)
 
 } // namespace
 
-/* static */
-bool OrphanedNodesManager::setOrphaned(const PulledPrimNode::Ptr& trieNode, bool orphaned)
+bool OrphanedNodesManager::setOrphaned(const Ufe::Path& triePath, bool orphaned)
 {
-    TF_VERIFY(trieNode->hasData());
+    const PulledPrimNode::Ptr trieNode = _pulledPrims.find(triePath);
+    if (!TF_VERIFY(trieNode)) {
+        return false;
+    }
 
     const PullVariantInfo& variantInfo = trieNode->data();
 
@@ -526,7 +771,7 @@ bool OrphanedNodesManager::setOrphaned(const PulledPrimNode::Ptr& trieNode, bool
     pullParentPath.pop();
     CHECK_MSTATUS_AND_RETURN(setNodeVisibility(pullParentPath, !orphaned), false);
 
-    const Ufe::Path pulledPrimPath = trieNodeToPulledPrimUfePath(trieNode);
+    const Ufe::Path pulledPrimPath = triePathToPulledPrimUfePath(triePath);
 
     // Note: if we are called due to the user deleting the stage, then the pulled prim
     //       path will be invalid and trying to add or remove information on it will
@@ -541,30 +786,44 @@ bool OrphanedNodesManager::setOrphaned(const PulledPrimNode::Ptr& trieNode, bool
         }
     }
 
-    return true;
+    return _pulledPrims.setOrphaned(triePath, orphaned);
 }
 
-/* static */
-void OrphanedNodesManager::recursiveSetOrphaned(const PulledPrimNode::Ptr& trieNode, bool orphaned)
+void OrphanedNodesManager::recursiveSetOrphaned(const Ufe::Path& triePath, bool orphaned)
 {
+    const PulledPrimNode::Ptr trieNode = _pulledPrims.node(triePath);
+    if (!trieNode) {
+        return;
+    }
+
+    // Skip the subtrees where all pulled prims are already in the requested
+    // state, which the trie node counts tell without traversing them.
+    const size_t nbToChange = orphaned ? (trieNode->nbPulled() - trieNode->nbOrphaned())
+                                       : trieNode->nbOrphaned();
+    if (nbToChange == 0) {
+        return;
+    }
+
     // We know in our case that a trie node with data can't have children,
     // since descendants of a pulled prim can't be pulled.
     if (trieNode->hasData()) {
         TF_VERIFY(trieNode->empty());
-        TF_VERIFY(setOrphaned(trieNode, orphaned));
+        TF_VERIFY(setOrphaned(triePath, orphaned));
     } else {
         auto childrenComponents = trieNode->childrenComponents();
         for (const auto& c : childrenComponents) {
-            recursiveSetOrphaned((*trieNode)[c], orphaned);
+            recursiveSetOrphaned(triePath + c, orphaned);
         }
     }
 }
 
-/* static */
-void OrphanedNodesManager::recursiveSwitch(
-    const PulledPrimNode::Ptr& trieNode,
-    const Ufe::Path&           ufePath)
+void OrphanedNodesManager::recursiveSwitch(const Ufe::Path& ufePath)
 {
+    const PulledPrimNode::Ptr trieNode = _pulledPrims.node(ufePath);
+    if (!trieNode) {
+        return;
+    }
+
     // We know in our case that a trie node with data can't have children,
     // since descendants of a pulled prim can't be pulled.  A trie node with
     // data is one that's been pulled.
@@ -585,21 +844,18 @@ void OrphanedNodesManager::recursiveSwitch(
         const auto  currentDesc = variantSetDescriptors(ufePath.pop());
         const bool  variantSetsMatch = (originalDesc == currentDesc);
         const bool  orphaned = (pulledNode && !variantSetsMatch);
-        TF_VERIFY(setOrphaned(trieNode, orphaned));
+        TF_VERIFY(setOrphaned(ufePath, orphaned));
     } else {
         const bool isGatewayToUsd = Ufe::SceneSegmentHandler::isGateway(ufePath);
         for (const auto& c : trieNode->childrenComponents()) {
-            auto childTrieNode = (*trieNode)[c];
-            if (childTrieNode) {
-                // When not crossing runtimes, we can simply use the UFE path
-                // component stored in the trie. When crossing runtimes, we
-                // need to create a segment instead with the new runtime ID.
-                if (!isGatewayToUsd) {
-                    recursiveSwitch(childTrieNode, ufePath + c);
-                } else {
-                    Ufe::PathSegment childSegment(c, ufe::getUsdRunTimeId(), '/');
-                    recursiveSwitch(childTrieNode, ufePath + childSegment);
-                }
+            // When not crossing runtimes, we can simply use the UFE path
+            // component stored in the trie. When crossing runtimes, we
+            // need to create a segment instead with the new runtime ID.
+            if (!isGatewayToUsd) {
+                recursiveSwitch(ufePath + c);
+            } else {
+                Ufe::PathSegment childSegment(c, ufe::getUsdRunTimeId(), '/');
+                recursiveSwitch(ufePath + childSegment);
             }
         }
     }
@@ -625,26 +881,4 @@ OrphanedNodesManager::variantSetDescriptors(const Ufe::Path& p)
     return vsd;
 }
 
-/* static */
-PulledPrims OrphanedNodesManager::deepCopy(const PulledPrims& src)
-{
-    PulledPrims dst;
-    deepCopy(src.root(), dst.root());
-    return dst;
-}
-
-/* static */
-void OrphanedNodesManager::deepCopy(const PulledPrimNode::Ptr& src, const PulledPrimNode::Ptr& dst)
-{
-    for (const auto& c : src->childrenComponents()) {
-        const auto& srcChild = (*src)[c];
-        auto        dstChild = std::make_shared<PulledPrimNode>(c);
-        dst->add(dstChild);
-        if (srcChild->hasData()) {
-            dstChild->setData(srcChild->data());
-        }
-        deepCopy(srcChild, dstChild);
-    }
-}
-
 } // namespace MAYAUSD_NS_DEF
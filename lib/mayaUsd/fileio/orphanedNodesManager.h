@@ -21,8 +21,13 @@
 #include <maya/MDagPath.h>
 #include <ufe/observer.h>
 #include <ufe/path.h>
+#include <ufe/pathComponent.h>
 #include <ufe/sceneNotification.h>
-#include <ufe/trie.h>
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace MAYAUSD_NS_DEF {
 
@@ -96,6 +101,116 @@ public:
         std::list<VariantSetDescriptor> variantSetDescriptors;
     };
 
+    /// \brief Prefix tree of the pulled prims, keyed by the components of their UFE path.
+    ///
+    /// The trie is persistent: copying it only copies its root, and modifications copy the
+    /// nodes along the modified path that are shared with another copy, such as a memento.
+    /// Preserving the state of the manager thus costs O(1), and each later modification costs
+    /// O(depth) the first time a path is modified after the copy.
+    ///
+    /// Each node also counts the pulled prims of its subtree, and how many of them are
+    /// orphaned, so that subtree queries do not need to traverse the subtree.
+    class MAYAUSD_CORE_PUBLIC PulledPrims
+    {
+    public:
+        class MAYAUSD_CORE_PUBLIC Node
+        {
+        public:
+            using Ptr = std::shared_ptr<const Node>;
+
+            Node() = default;
+            Node(const Ufe::PathComponent& component)
+                : _component(component)
+            {
+            }
+
+            const Ufe::PathComponent& component() const { return _component; }
+
+            bool                   hasData() const { return _hasData; }
+            const PullVariantInfo& data() const { return _data; }
+            bool                   isOrphaned() const { return _orphaned; }
+
+            // Number of pulled prims in the subtree, including this node.
+            size_t nbPulled() const { return _nbPulled; }
+            // Number of orphaned pulled prims in the subtree, including this node.
+            size_t nbOrphaned() const { return _nbOrphaned; }
+
+            bool                            empty() const { return _children.empty(); }
+            std::vector<Ufe::PathComponent> childrenComponents() const;
+
+            // Return the child with the argument component, or null if there is none.
+            Ptr operator[](const Ufe::PathComponent& component) const;
+
+        private:
+            friend class PulledPrims;
+
+            Ufe::PathComponent                                            _component;
+            std::unordered_map<Ufe::PathComponent, std::shared_ptr<Node>> _children;
+            PullVariantInfo                                               _data;
+            bool                                                          _hasData = false;
+            bool                                                          _orphaned = false;
+            size_t                                                        _nbPulled = 0;
+            size_t                                                        _nbOrphaned = 0;
+        };
+
+        PulledPrims();
+
+        // Copies share all their nodes, so copying is cheap.  Moves are copies,
+        // so that a trie always has a root.
+        PulledPrims(const PulledPrims&) = default;
+        PulledPrims& operator=(const PulledPrims&) = default;
+
+        Node::Ptr root() const { return _root; }
+
+        // Return the node of the argument path, with or without data, or null.
+        Node::Ptr node(const Ufe::Path& path) const;
+
+        // Return the node of the argument path if it has data, else null.
+        Node::Ptr find(const Ufe::Path& path) const;
+
+        // Return whether there are pulled prims strictly below the argument path.
+        bool containsDescendant(const Ufe::Path& path) const;
+
+        // Return whether there are pulled prims at or below the argument path.
+        bool containsDescendantInclusive(const Ufe::Path& path) const;
+
+        bool empty() const { return _root->_nbPulled == 0; }
+
+        // Set the data of the argument path, adding its node if needed.
+        void add(const Ufe::Path& path, const PullVariantInfo& info, bool orphaned = false);
+
+        // Remove the node of the argument path, which must have data, and
+        // its ancestors that are left empty.  Returns false if not found.
+        bool remove(const Ufe::Path& path);
+
+        // Move the subtree of the old path to the new path.  Returns false
+        // if there is no node at the old path.
+        bool move(const Ufe::Path& oldPath, const Ufe::Path& newPath);
+
+        // Replace the data of the argument path, which must have data.
+        bool setData(const Ufe::Path& path, const PullVariantInfo& info);
+
+        // Set the orphaned flag of the argument path, which must have data.
+        bool setOrphaned(const Ufe::Path& path, bool orphaned);
+
+        void clear();
+
+    private:
+        // Return the nodes from the root to the argument path, adding the
+        // missing ones and copying the ones shared with another trie.
+        std::vector<Node*>    exclusiveNodes(const Ufe::Path& path);
+        std::shared_ptr<Node> detach(const Ufe::Path& path);
+
+        static void adjustCounts(
+            const std::vector<Node*>& nodes,
+            std::ptrdiff_t            pulled,
+            std::ptrdiff_t            orphaned);
+
+        std::shared_ptr<Node> _root;
+    };
+
+    using PulledPrimNode = PulledPrims::Node;
+
     /// \brief Entire state of the OrphanedNodesManager at a point in time, used for undo/redo.
     class MAYAUSD_CORE_PUBLIC Memento
     {
@@ -117,11 +232,11 @@ public:
         // Private, for opacity.
         friend class OrphanedNodesManager;
 
-        Memento(Ufe::Trie<PullVariantInfo>&& pulledPrims);
+        Memento(PulledPrims&& pulledPrims);
 
-        Ufe::Trie<PullVariantInfo> release();
+        PulledPrims release();
 
-        Ufe::Trie<PullVariantInfo> _pulledPrims;
+        PulledPrims _pulledPrims;
     };
 
     // Construct an empty orphan manager.
@@ -144,10 +259,12 @@ public:
     // Returns an empty info if the prim was not tracked by the orphan manager.
     const PullVariantInfo& get(const Ufe::Path& pulledPath) const;
 
-    // Preserve the trie of pulled prims into a memento.
+    // Preserve the trie of pulled prims into a memento.  The memento shares
+    // the nodes of the trie, so this does not copy the trie.
     Memento preserve() const;
 
     // Restore the trie of pulled prims to the content of the argument memento.
+    // The orphaned flags are then synchronized with the pull parents visibility.
     void restore(Memento&& previous);
 
     // Clear all pulled paths from the trie of pulled prims.
@@ -160,24 +277,25 @@ public:
     // orphaned.
     bool isOrphaned(const Ufe::Path& pulledPath) const;
 
-    using PulledPrims = Ufe::Trie<PullVariantInfo>;
-    using PulledPrimNode = Ufe::TrieNode<PullVariantInfo>;
+    // Return the number of pulled prims at or below the argument path, and
+    // how many of them are orphaned.  Both are read from the trie node of
+    // the path, without traversing its subtree.
+    size_t nbPulled(const Ufe::Path& path) const;
+    size_t nbOrphaned(const Ufe::Path& path) const;
+
     const PulledPrims& getPulledPrims() const { return _pulledPrims; }
 
 private:
     void handleOp(const Ufe::SceneCompositeNotification::Op& op);
 
-    static void recursiveSetOrphaned(const PulledPrimNode::Ptr& trieNode, bool orphaned);
-    static void recursiveSwitch(const PulledPrimNode::Ptr& trieNode, const Ufe::Path& ufePath);
+    void recursiveSetOrphaned(const Ufe::Path& triePath, bool orphaned);
+    void recursiveSwitch(const Ufe::Path& ufePath);
 
-    static bool setOrphaned(const PulledPrimNode::Ptr& trieNode, bool orphaned);
+    bool setOrphaned(const Ufe::Path& triePath, bool orphaned);
 
     // Member function to access private nested classes.
     static std::list<VariantSetDescriptor> variantSetDescriptors(const Ufe::Path& path);
 
-    static PulledPrims deepCopy(const PulledPrims& src);
-    static void        deepCopy(const PulledPrimNode::Ptr& src, const PulledPrimNode::Ptr& dst);
-
     // Trie for fast lookup of descendant pulled prims.  The Trie key is the
     // UFE pulled path, and the Trie value is the corresponding Dag pull parent
     // and all ancestor variant set selections.
@@ -16,6 +16,7 @@
 
 #include "orphanedNodesManager.h"
 
+#include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/utils/json.h>
 
 #include <pxr/base/js/json.h>
@@ -24,7 +25,6 @@
 #include <maya/MDagPath.h>
 #include <maya/MString.h>
 #include <ufe/pathString.h>
-#include <ufe/trie.imp.h>
 
 namespace MAYAUSD_NS_DEF {
 
@@ -38,6 +38,7 @@ namespace {
 //    {
 //       "/UFE-path-component-1" : {
 //          "/UFE-path-component-2" : {
+//             "orphaned": true,
 //             "pull info": {
 //                "editedAsMayaRoot": "DAG-path-of-root-of-generated-Maya-data"
 //                "variantSetDescriptors": [
@@ -56,9 +57,12 @@ namespace {
 //
 // Each UFE path component is prefixed by a slash ('/') to differentiate them
 // from pull info data, which has a JOSN key without that slash prefix.
+//
+// The "orphaned" key is only written for orphaned pulled prims.
 
 static const std::string ufeComponentPrefix = "/";
 static const std::string pullInfoJsonKey = "pull info";
+static const std::string orphanedJsonKey = "orphaned";
 static const std::string editedAsMayaRootJsonKey = "editedAsMayaRoot";
 static const std::string variantSetDescriptorsJsonKey = "variantSetDescriptors";
 static const std::string pathJsonKey = "path";
@@ -74,8 +78,8 @@ using VariantSelection = OrphanedNodesManager::VariantSelection;
 using VariantSetDesc = OrphanedNodesManager::VariantSetDescriptor;
 using VariantSetDescList = std::list<VariantSetDesc>;
 using PullVariantInfo = OrphanedNodesManager::PullVariantInfo;
-using PullInfoTrie = Ufe::Trie<PullVariantInfo>;
-using PullInfoTrieNode = Ufe::TrieNode<PullVariantInfo>;
+using PullInfoTrie = OrphanedNodesManager::PulledPrims;
+using PullInfoTrieNode = OrphanedNodesManager::PulledPrimNode;
 using Memento = OrphanedNodesManager::Memento;
 
 ////////////////////////////////////////////////////////////////////////////
@@ -97,7 +101,7 @@ VariantSelection   convertToVariantSelection(const PXR_NS::JsArray& variantSelJs
 VariantSetDesc     convertToVariantSetDescriptor(const PXR_NS::JsObject& variantDescJson);
 VariantSetDescList convertToVariantSetDescList(const PXR_NS::JsArray& allVariantDescJson);
 PullVariantInfo    convertToPullVariantInfo(const PXR_NS::JsObject& pullInfoJson);
-void         convertToPullInfoTrieNodePtr(const PXR_NS::JsObject&, PullInfoTrieNode::Ptr intoRoot);
+void convertToPullInfoTrieNode(const PXR_NS::JsObject&, const Ufe::Path&, PullInfoTrie& intoTrie);
 PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPulledInfoJson);
 
 PXR_NS::JsArray convertToArray(const VariantSelection& variantSel)
@@ -210,6 +214,8 @@ PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNodePtr)
 
     if (pullInfoNode.hasData()) {
         pullInfoNodeJson[pullInfoJsonKey] = convertToObject(pullInfoNode.data());
+        if (pullInfoNode.isOrphaned())
+            pullInfoNodeJson[orphanedJsonKey] = PXR_NS::JsValue(true);
     }
 
     for (const auto& child : pullInfoNode.childrenComponents()) {
@@ -222,9 +228,10 @@ PXR_NS::JsObject convertToObject(const PullInfoTrieNode::Ptr& pullInfoNodePtr)
     return pullInfoNodeJson;
 }
 
-void convertToPullInfoTrieNodePtr(
+void convertToPullInfoTrieNode(
     const PXR_NS::JsObject& pullInfoNodeJson,
-    PullInfoTrieNode::Ptr   intoRoot)
+    const Ufe::Path&        nodePath,
+    PullInfoTrie&           intoTrie)
 {
     for (const auto& keyValue : pullInfoNodeJson) {
         const std::string&     key = keyValue.first;
@@ -232,12 +239,23 @@ void convertToPullInfoTrieNodePtr(
         if (key.size() <= 0) {
             continue;
         } else if (key == pullInfoJsonKey) {
-            intoRoot->setData(convertToPullVariantInfo(convertToObject(value)));
+            const auto orphaned = pullInfoNodeJson.find(orphanedJsonKey);
+            intoTrie.add(
+                nodePath,
+                convertToPullVariantInfo(convertToObject(value)),
+                orphaned != pullInfoNodeJson.end() && orphaned->second.IsBool()
+                    && orphaned->second.GetBool());
 
         } else if (key[0] == '/') {
-            PullInfoTrieNode::Ptr child = std::make_shared<PullInfoTrieNode>(key.substr(1));
-            intoRoot->add(child);
-            convertToPullInfoTrieNodePtr(convertToObject(value), child);
+            // Note: the trie only uses the path components, so the segments
+            //       of the child path do not need to match the run-times.
+            const Ufe::PathComponent child(key.substr(1));
+            Ufe::Path                childPath;
+            if (nodePath.empty())
+                childPath = Ufe::Path(Ufe::PathSegment(child, ufe::getMayaRunTimeId(), '|'));
+            else
+                childPath = nodePath + child;
+            convertToPullInfoTrieNode(convertToObject(value), childPath, intoTrie);
         }
     }
 }
@@ -251,7 +269,7 @@ PullInfoTrie convertToPullInfoTrie(const PXR_NS::JsObject& allPullInfoJson)
 {
     PullInfoTrie allPullInfo;
 
-    convertToPullInfoTrieNodePtr(allPullInfoJson, allPullInfo.root());
+    convertToPullInfoTrieNode(allPullInfoJson, Ufe::Path(), allPullInfo);
 
     return allPullInfo;
 }
@@ -15,14 +15,19 @@
 //
 #include "primReaderContext.h"
 
+#include <mayaUsd/fileio/utils/meshReadUtils.h>
+
 #include <pxr/base/tf/diagnostic.h>
 
+#include <utility>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 UsdMayaPrimReaderContext::UsdMayaPrimReaderContext(ObjectRegistry* pathNodeMap)
     : _prune(false)
     , _timeSampleMultiplier(1.0)
     , _pathNodeMap(pathNodeMap)
+    , _meshReadData(nullptr)
 {
 }
 
@@ -95,4 +100,25 @@ void UsdMayaPrimReaderContext::SetTimeSampleMultiplier(double multiplier)
     _timeSampleMultiplier = multiplier;
 };
 
+void UsdMayaPrimReaderContext::SetMeshReadData(MeshReadDataMap* meshReadData)
+{
+    _meshReadData = meshReadData;
+}
+
+bool UsdMayaPrimReaderContext::TakeMeshReadData(const SdfPath& path, UsdMayaMeshReadData* data)
+{
+    if (!_meshReadData) {
+        return false;
+    }
+
+    auto it = _meshReadData->find(path);
+    if (it == _meshReadData->end()) {
+        return false;
+    }
+
+    *data = std::move(it->second);
+    _meshReadData->erase(it);
+    return true;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -23,8 +23,12 @@
 
 #include <maya/MObject.h>
 
+#include <unordered_map>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+struct UsdMayaMeshReadData;
+
 /// \class UsdMayaPrimReaderContext
 /// \brief This class provides an interface for reader plugins to communicate
 /// state back to the core usd maya logic as well as retrieve information set by
@@ -42,6 +46,8 @@ public:
     typedef std::map<std::string, MObject> ObjectRegistry;
     typedef TfSmallVector<MObject, 4>      MayaObjectList;
 
+    typedef std::unordered_map<SdfPath, UsdMayaMeshReadData, SdfPath::Hash> MeshReadDataMap;
+
     MAYAUSD_CORE_PUBLIC
     UsdMayaPrimReaderContext(ObjectRegistry* pathNodeMap);
 
@@ -94,6 +100,16 @@ public:
     MAYAUSD_CORE_PUBLIC
     void SetTimeSampleMultiplier(double multiplier);
 
+    /// \brief Set the mesh data read ahead of the prim readers, for example by the import job.
+    MAYAUSD_CORE_PUBLIC
+    void SetMeshReadData(MeshReadDataMap* meshReadData);
+
+    /// \brief Moves the mesh data read ahead for the prim at \p path into \p data.
+    ///
+    /// Returns false if no data was read ahead for that prim. The data can only be taken once.
+    MAYAUSD_CORE_PUBLIC
+    bool TakeMeshReadData(const SdfPath& path, UsdMayaMeshReadData* data);
+
     ~UsdMayaPrimReaderContext() { }
 
 private:
@@ -104,6 +120,9 @@ private:
     // for undo/redo
     ObjectRegistry* _pathNodeMap;
 
+    // Mesh data read ahead of the prim readers, if any.
+    MeshReadDataMap* _meshReadData;
+
     // Tracks new nodes. It is possible that a code branch will decide to work on a copy of the
     // context, so wrap the tracker in a shared pointer.
     std::shared_ptr<MayaObjectList> _trackedNewMayaNodes;
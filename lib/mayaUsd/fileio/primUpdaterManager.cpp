@@ -122,8 +122,9 @@ SdfPath makeDstPath(const SdfPath& dstRootParentPath, const SdfPath& srcPath)
 
 //------------------------------------------------------------------------------
 //
-// Verify if the given prim under the given UFE path is an ancestor of an already edited prim.
-bool hasEditedDescendant(const Ufe::Path& ufeQueryPath)
+// Verify if the given prim under the given UFE path is an ancestor of an already edited prim,
+// by reading the pull information of all members of the pull set.
+bool pullSetHasEditedDescendant(const Ufe::Path& ufeQueryPath)
 {
     MObject pullSetObj;
     auto    status = UsdMayaUtil::GetMObjectByName(kPullSetName, pullSetObj);
@@ -1110,6 +1111,19 @@ bool PrimUpdaterManager::mergeToUsd(
     return true;
 }
 
+bool PrimUpdaterManager::hasEditedDescendant(const Ufe::Path& ufeQueryPath) const
+{
+#ifdef HAS_ORPHANED_NODES_MANAGER
+    // The orphaned nodes manager indexes the pulled prims by path prefix, so
+    // the query is proportional to the depth of the path, not to the number
+    // of pulled prims.
+    if (_orphanedNodesManager) {
+        return _orphanedNodesManager->getPulledPrims().containsDescendantInclusive(ufeQueryPath);
+    }
+#endif
+    return pullSetHasEditedDescendant(ufeQueryPath);
+}
+
 bool PrimUpdaterManager::editAsMaya(const Ufe::Path& path, const VtDictionary& userArgs)
 {
     if (hasEditedDescendant(path)) {
@@ -1823,12 +1837,13 @@ PrimUpdaterManager::PulledPrimPaths PrimUpdaterManager::getPulledPrimPaths() con
     if (!_orphanedNodesManager)
         return pulledPaths;
 
+    using PulledPrimNode = const OrphanedNodesManager::PulledPrimNode;
+
     const OrphanedNodesManager::PulledPrims& pulledPrims = _orphanedNodesManager->getPulledPrims();
-    MayaUsd::TrieVisitor<OrphanedNodesManager::PullVariantInfo>::visit(
-        pulledPrims,
-        [&pulledPaths](
-            const Ufe::Path&                                            path,
-            const Ufe::TrieNode<OrphanedNodesManager::PullVariantInfo>& node) {
+    MayaUsd::TrieVisitor<OrphanedNodesManager::PullVariantInfo, PulledPrimNode>::visit(
+        Ufe::Path(),
+        pulledPrims.root(),
+        [&pulledPaths](const Ufe::Path& path, PulledPrimNode& node) {
             pulledPaths.emplace_back(path, node.data().editedAsMayaRoot);
         });
 
@@ -1914,16 +1929,50 @@ void PrimUpdaterManager::loadOrphanedNodesManagerData()
 
     beginManagePulledPrims();
 
-    if (!hasDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName))
-        return;
-
     MString json;
-    if (!getDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName, json))
+    if (!hasDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName)
+        || !getDynamicAttribute(pullRoot, orphanedNodesManagerDynAttrName, json)) {
+        indexPullSetMembers();
         return;
+    }
 
     _orphanedNodesManager->restore(OrphanedNodesManager::Memento::convertFromJson(json.asChar()));
 }
 
+void PrimUpdaterManager::indexPullSetMembers()
+{
+    // Files saved without the orphaned nodes manager state still need their
+    // pulled prims to be indexed, so that edited descendant queries see them.
+    MObject pullSetObj;
+    auto    status = UsdMayaUtil::GetMObjectByName(kPullSetName, pullSetObj);
+    if (status != MStatus::kSuccess)
+        return;
+
+    MFnSet         fnPullSet(pullSetObj);
+    MSelectionList members;
+    const bool     flatten = true;
+    fnPullSet.getMembers(members, flatten);
+
+    for (unsigned int i = 0; i < members.length(); ++i) {
+        MDagPath  pulledDagPath;
+        Ufe::Path pulledUfePath;
+        members.getDagPath(i, pulledDagPath);
+        if (!readPullInformation(pulledDagPath, pulledUfePath))
+            continue;
+
+        // The variant selections of the ancestors are read from the stage,
+        // so the pulled prim must still exist.
+        if (!MayaUsd::ufe::ufePathToPrim(pulledUfePath))
+            continue;
+
+        const auto& pulledPrims = _orphanedNodesManager->getPulledPrims();
+        if (pulledPrims.containsDescendantInclusive(pulledUfePath))
+            continue;
+
+        _orphanedNodesManager->add(pulledUfePath, pulledDagPath);
+    }
+}
+
 void PrimUpdaterManager::saveOrphanedNodesManagerData()
 {
     MObject pullRoot = findPullRoot();
@@ -90,6 +90,10 @@ private:
     PrimUpdaterManager(PrimUpdaterManager&) = delete;
     PrimUpdaterManager(PrimUpdaterManager&&) = delete;
 
+    //! Verify if the prim at the given UFE path is an ancestor of an already
+    //! edited prim, or is itself edited.
+    bool hasEditedDescendant(const Ufe::Path& ufeQueryPath) const;
+
     bool discardPrimEdits(const Ufe::Path& pulledPath);
     bool discardOrphanedEdits(const MDagPath& dagPath, const Ufe::Path& pulledPath);
     void discardPullSetIfEmpty();
@@ -132,6 +136,7 @@ private:
 
     void loadOrphanedNodesManagerData();
     void saveOrphanedNodesManagerData();
+    void indexPullSetMembers();
 #endif
 
     friend class TfSingleton<PrimUpdaterManager>;
@@ -67,11 +67,14 @@ TranslatorMeshRead::TranslatorMeshRead(
     // ==============================================
     // construct a Maya mesh
     // ==============================================
-    VtIntArray faceVertexCounts;
-    VtIntArray faceVertexIndices;
+    // Use the USD data read ahead by the import job, if any, otherwise read it now.
+    UsdMayaMeshReadData data;
+    if (!context || !context->TakeMeshReadData(prim.GetPath(), &data)
+        || data.frameRange != frameRange) {
+        UsdMayaMeshReadUtils::readMeshData(mesh, frameRange, &data);
+    }
 
-    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
-    if (fvc.ValueMightBeTimeVarying()) {
+    if (data.faceVertexCountsVarying) {
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         TF_RUNTIME_ERROR(
@@ -79,12 +82,9 @@ TranslatorMeshRead::TranslatorMeshRead(
             "faceVertexCounts), which isn't currently supported. "
             "Skipping...",
             prim.GetPath().GetText());
-    } else {
-        fvc.Get(&faceVertexCounts, UsdTimeCode::EarliestTime());
     }
 
-    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
-    if (fvi.ValueMightBeTimeVarying()) {
+    if (data.faceVertexIndicesVarying) {
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         TF_RUNTIME_ERROR(
@@ -92,10 +92,11 @@ TranslatorMeshRead::TranslatorMeshRead(
             "faceVertexIndices), which isn't currently supported. "
             "Skipping...",
             prim.GetPath().GetText());
-    } else {
-        fvi.Get(&faceVertexIndices, UsdTimeCode::EarliestTime());
     }
 
+    const VtIntArray& faceVertexCounts = data.faceVertexCounts;
+    const VtIntArray& faceVertexIndices = data.faceVertexIndices;
+
     // Sanity Checks. If the vertex arrays are empty, skip this mesh
     if (faceVertexCounts.empty() || faceVertexIndices.empty()) {
         TF_RUNTIME_ERROR(
@@ -106,54 +107,11 @@ TranslatorMeshRead::TranslatorMeshRead(
             prim.GetPath().GetText());
     }
 
-    // If the USD mesh was left-handed, then the faces had their vertices in left-handed order.
-    // Fix them to be in right-handed order, as expected by Maya.
-    if (isPrimitiveLeftHanded(mesh)) {
-        size_t firstIndex = 0;
-        for (int vertexCount : faceVertexCounts) {
-            std::reverse(
-                faceVertexIndices.begin() + firstIndex,
-                faceVertexIndices.begin() + firstIndex + vertexCount);
-            firstIndex += vertexCount;
-        }
-    }
-
-    // Gather points and normals
-    // If timeInterval is non-empty, pick the first available sample in the
-    // timeInterval or default.
-    VtVec3fArray        points;
-    VtVec3fArray        normals;
-    TfToken             normalsInterpolation;
-    UsdTimeCode         pointsTimeSample = UsdTimeCode::EarliestTime();
-    UsdTimeCode         normalsTimeSample = UsdTimeCode::EarliestTime();
-    std::vector<double> pointsTimeSamples;
-
-    if (!frameRange.IsEmpty()) {
-        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &pointsTimeSamples);
-        if (!pointsTimeSamples.empty()) {
-            m_pointsNumTimeSamples = pointsTimeSamples.size();
-            pointsTimeSample = pointsTimeSamples.front();
-        }
-
-        std::vector<double> normalsTimeSamples;
-        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
-        if (!normalsTimeSamples.empty()) {
-            normalsTimeSample = normalsTimeSamples.front();
-        }
-    }
-
-    mesh.GetPointsAttr().Get(&points, pointsTimeSample);
-
-    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
-    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
-
-    if (primvar.HasValue()) {
-        primvar.ComputeFlattened(&normals, normalsTimeSample);
-        normalsInterpolation = primvar.GetInterpolation();
-    } else {
-        mesh.GetNormalsAttr().Get(&normals, normalsTimeSample);
-        normalsInterpolation = mesh.GetNormalsInterpolation();
-    }
+    VtVec3fArray&              points = data.points;
+    VtVec3fArray&              normals = data.normals;
+    const TfToken&             normalsInterpolation = data.normalsInterpolation;
+    const std::vector<double>& pointsTimeSamples = data.pointsTimeSamples;
+    m_pointsNumTimeSamples = pointsTimeSamples.size();
 
     if (points.empty()) {
         TF_RUNTIME_ERROR(
@@ -364,16 +322,6 @@ TranslatorMeshRead::TranslatorMeshRead(
     *status = stat;
 }
 
-bool TranslatorMeshRead::isPrimitiveLeftHanded(const UsdGeomGprim& prim)
-{
-    TfToken orientation;
-    if (!prim.GetOrientationAttr().Get(&orientation)) {
-        return false;
-    }
-
-    return orientation == UsdGeomTokens->leftHanded;
-}
-
 MStatus TranslatorMeshRead::setPointBasedDeformerForMayaNode(
     const MObject& mayaObj,
     const MObject& stageNode,
@@ -22,6 +22,7 @@
 
 #include <pxr/base/tf/staticData.h>
 #include <pxr/base/tf/staticTokens.h>
+#include <pxr/base/work/loops.h>
 #include <pxr/usd/usdSkel/skeleton.h>
 #include <pxr/usd/usdSkel/skeletonQuery.h>
 #include <pxr/usd/usdSkel/skinningQuery.h>
@@ -46,6 +47,10 @@
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // There are a lot of nodes and connections that go into a basic skinning rig.
@@ -206,85 +211,109 @@ bool _SetAnimPlugData(
     return true;
 }
 
+/// The values of the transform attributes at each time of an animation.
+struct _TransformAnim
+{
+    std::vector<double> translates[3];
+    std::vector<double> rotates[3];
+    std::vector<double> scales[3];
+};
+
+/// Returns the rotate order of \p transformNode.
+MEulerRotation::RotationOrder _GetRotateOrder(const MFnDependencyNode& transformNode)
+{
+    MPlug rotOrder = transformNode.findPlug("rotateOrder");
+    return static_cast<MEulerRotation::RotationOrder>(rotOrder.asInt());
+}
+
+/// Decomposes the \p xforms at each time into \p anim.
+/// If \p applyEulerFilter is true, the rotations are made continuous for
+/// the \p rotateOrder of the transform node.
+///
+/// No Maya node is accessed, so this can be called from any thread.
+void _DecomposeTransformAnim(
+    const std::vector<GfMatrix4d>& xforms,
+    bool                           applyEulerFilter,
+    MEulerRotation::RotationOrder  rotateOrder,
+    _TransformAnim*                anim)
+{
+    const size_t numSamples = xforms.size();
+    for (int c = 0; c < 3; ++c) {
+        anim->translates[c].assign(numSamples, 0.0);
+        anim->rotates[c].assign(numSamples, 0.0);
+        anim->scales[c].assign(numSamples, 1.0);
+    }
+
+    // Decompose all transforms.
+    for (size_t i = 0; i < numSamples; ++i) {
+        GfVec3d t, r, s;
+        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xforms[i], &t, &r, &s)) {
+            for (int c = 0; c < 3; ++c) {
+                anim->translates[c][i] = t[c];
+                anim->rotates[c][i] = r[c];
+                anim->scales[c][i] = s[c];
+            }
+        }
+    }
+
+    if (applyEulerFilter && numSamples > 1) {
+        auto& rotates = anim->rotates;
+
+        MEulerRotation last(rotates[0][0], rotates[1][0], rotates[2][0], rotateOrder);
+        for (size_t i = 1; i < numSamples; ++i) {
+            MEulerRotation current(rotates[0][i], rotates[1][i], rotates[2][i], rotateOrder);
+            current.setToClosestSolution(last);
+            rotates[0][i] = current[0];
+            rotates[1][i] = current[1];
+            rotates[2][i] = current[2];
+            last = current;
+        }
+    }
+}
+
 /// Set animation on \p transformNode.
-/// The \p xforms holds transforms at each time, while the \p times
-/// array holds the corresponding times.
+/// The \p anim holds the decomposed transforms at each time, while the
+/// \p times array holds the corresponding times.
 bool _SetTransformAnim(
     MFnDependencyNode&              transformNode,
-    const std::vector<GfMatrix4d>&  xforms,
+    const _TransformAnim&           anim,
     MTimeArray&                     times,
-    const UsdMayaPrimReaderContext* context,
-    bool                            applyEulerFilter)
+    const UsdMayaPrimReaderContext* context)
 {
-    if (xforms.size() != times.length()) {
-        TF_WARN("xforms size [%zu] != times size [%du].", xforms.size(), times.length());
+    const size_t numValues = anim.translates[0].size();
+    if (numValues != times.length()) {
+        TF_WARN("xforms size [%zu] != times size [%du].", numValues, times.length());
         return false;
     }
-    if (xforms.empty())
+    if (numValues == 0)
         return true;
 
-    MStatus status;
-
     const unsigned int numSamples = times.length();
 
     if (numSamples > 1) {
-        MDoubleArray translates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray rotates[3]
-            = { MDoubleArray(numSamples), MDoubleArray(numSamples), MDoubleArray(numSamples) };
-        MDoubleArray scales[3] = { MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1),
-                                   MDoubleArray(numSamples, 1) };
-
-        // Decompose all transforms.
-        for (unsigned int i = 0; i < numSamples; ++i) {
-            const auto& xform = xforms[i];
-            GfVec3d     t, r, s;
-            if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-                for (int c = 0; c < 3; ++c) {
-                    translates[c][i] = t[c];
-                    rotates[c][i] = r[c];
-                    scales[c][i] = s[c];
-                }
-            }
-        }
-
-        if (applyEulerFilter) {
-            MPlug                         rotOrder = transformNode.findPlug("rotateOrder");
-            MEulerRotation::RotationOrder order
-                = static_cast<MEulerRotation::RotationOrder>(rotOrder.asInt());
-
-            MEulerRotation last(rotates[0][0], rotates[1][0], rotates[2][0], order);
-            for (unsigned int i = 1; i < rotates[0].length(); ++i) {
-                MEulerRotation current(rotates[0][i], rotates[1][i], rotates[2][i], order);
-                current.setToClosestSolution(last);
-                rotates[0][i] = current[0];
-                rotates[1][i] = current[1];
-                rotates[2][i] = current[2];
-                last = current;
-            }
-        }
-
+        // Set all the keys of each curve at once.
         for (int c = 0; c < 3; ++c) {
+            MDoubleArray translates(anim.translates[c].data(), numSamples);
+            MDoubleArray rotates(anim.rotates[c].data(), numSamples);
+            MDoubleArray scales(anim.scales[c].data(), numSamples);
             if (!_SetAnimPlugData(
-                    transformNode, _MayaTokens->translates[c], translates[c], times, context)
+                    transformNode, _MayaTokens->translates[c], translates, times, context)
                 || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->rotates[c], rotates[c], times, context)
+                    transformNode, _MayaTokens->rotates[c], rotates, times, context)
                 || !_SetAnimPlugData(
-                    transformNode, _MayaTokens->scales[c], scales[c], times, context)) {
+                    transformNode, _MayaTokens->scales[c], scales, times, context)) {
                 return false;
             }
         }
     } else {
-        const auto& xform = xforms.front();
-        GfVec3d     t, r, s;
-        if (UsdMayaTranslatorXformable::ConvertUsdMatrixToComponents(xform, &t, &r, &s)) {
-            for (int c = 0; c < 3; ++c) {
-                if (!UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->translates[c], t[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->rotates[c], r[c])
-                    || !UsdMayaUtil::setPlugValue(transformNode, _MayaTokens->scales[c], s[c])) {
-                    return false;
-                }
+        for (int c = 0; c < 3; ++c) {
+            if (!UsdMayaUtil::setPlugValue(
+                    transformNode, _MayaTokens->translates[c], anim.translates[c][0])
+                || !UsdMayaUtil::setPlugValue(
+                    transformNode, _MayaTokens->rotates[c], anim.rotates[c][0])
+                || !UsdMayaUtil::setPlugValue(
+                    transformNode, _MayaTokens->scales[c], anim.scales[c][0])) {
+                return false;
             }
         }
     }
@@ -502,14 +531,18 @@ bool _CopyAnimFromSkel(
 
     MStatus status;
 
+    const bool applyEulerFilter = args.GetJobArguments().applyEulerFilter;
+
     // Pre-sample the Skeleton's local transforms.
     std::vector<GfMatrix4d>      skelLocalXforms(usdTimes.size());
     UsdGeomXformable::XformQuery xfQuery(skelQuery.GetSkeleton());
-    for (size_t i = 0; i < usdTimes.size(); ++i) {
-        if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i], usdTimes[i])) {
-            skelLocalXforms[i].SetIdentity();
+    WorkParallelForN(usdTimes.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (!xfQuery.GetLocalTransformation(&skelLocalXforms[i], usdTimes[i])) {
+                skelLocalXforms[i].SetIdentity();
+            }
         }
-    }
+    });
 
     if (jointContainerIsSkeleton) {
         // The jointContainer is being used to represent the Skeleton.
@@ -518,52 +551,86 @@ bool _CopyAnimFromSkel(
         MFnDependencyNode skelXformDep(jointContainer, &status);
         CHECK_MSTATUS_AND_RETURN(status, false);
 
-        if (!_SetTransformAnim(
-                skelXformDep,
-                skelLocalXforms,
-                mayaTimes,
-                context,
-                args.GetJobArguments().applyEulerFilter)) {
+        _TransformAnim skelAnim;
+        _DecomposeTransformAnim(
+            skelLocalXforms,
+            applyEulerFilter,
+            applyEulerFilter ? _GetRotateOrder(skelXformDep) : MEulerRotation::kXYZ,
+            &skelAnim);
+        if (!_SetTransformAnim(skelXformDep, skelAnim, mayaTimes, context)) {
             return false;
         }
     }
 
-    // Pre-sample all joint animation.
+    // Pre-sample all joint animation, in parallel over the times.
+    const UsdSkelTopology&       topology = skelQuery.GetTopology();
     std::vector<VtMatrix4dArray> samples(usdTimes.size());
-    for (size_t i = 0; i < samples.size(); ++i) {
-        if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
-            return false;
-        }
-        if (!jointContainerIsSkeleton) {
-            // We do not have a node to receive the local transforms of the
-            // Skeleton, so any local transforms on the Skeleton must be
-            // concatened onto the root joints instead.
-            for (size_t j = 0; j < skelQuery.GetTopology().GetNumJoints(); ++j) {
-                if (skelQuery.GetTopology().GetParent(j) < 0) {
-                    // This is a root joint. Concat by the local skel xform.
-                    samples[i][j] *= skelLocalXforms[i];
+    std::atomic<bool>            sampled { true };
+    WorkParallelForN(samples.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end && sampled; ++i) {
+            if (!skelQuery.ComputeJointLocalTransforms(&samples[i], usdTimes[i])) {
+                sampled = false;
+                return;
+            }
+            if (!jointContainerIsSkeleton) {
+                // We do not have a node to receive the local transforms of the
+                // Skeleton, so any local transforms on the Skeleton must be
+                // concatened onto the root joints instead.
+                for (size_t j = 0; j < topology.GetNumJoints(); ++j) {
+                    if (topology.GetParent(j) < 0) {
+                        // This is a root joint. Concat by the local skel xform.
+                        samples[i][j] *= skelLocalXforms[i];
+                    }
                 }
             }
         }
+    });
+    if (!sampled) {
+        return false;
     }
 
-    MFnDependencyNode jointDep;
+    // The joints are handled in batches, to bound the memory used by their
+    // decomposed transforms. The transforms of a batch are decomposed and
+    // filtered in parallel, then only the anim curves are created serially.
+    const size_t numJoints = jointNodes.size();
+    const size_t batchSize = std::min<size_t>(numJoints, 64);
 
-    std::vector<GfMatrix4d> xforms(samples.size());
+    MFnDependencyNode jointDep;
 
-    for (size_t jointIdx = 0; jointIdx < jointNodes.size(); ++jointIdx) {
+    std::vector<MEulerRotation::RotationOrder> rotateOrders(batchSize, MEulerRotation::kXYZ);
+    std::vector<_TransformAnim>                anims(batchSize);
 
-        if (!jointDep.setObject(jointNodes[jointIdx]))
-            continue;
+    for (size_t batchStart = 0; batchStart < numJoints; batchStart += batchSize) {
+        const size_t batchEnd = std::min(numJoints, batchStart + batchSize);
 
-        // Get the transforms of just this joint.
-        for (size_t i = 0; i < samples.size(); ++i) {
-            xforms[i] = samples[i][jointIdx];
+        if (applyEulerFilter) {
+            for (size_t jointIdx = batchStart; jointIdx < batchEnd; ++jointIdx) {
+                rotateOrders[jointIdx - batchStart] = jointDep.setObject(jointNodes[jointIdx])
+                    ? _GetRotateOrder(jointDep)
+                    : MEulerRotation::kXYZ;
+            }
         }
 
-        if (!_SetTransformAnim(
-                jointDep, xforms, mayaTimes, context, args.GetJobArguments().applyEulerFilter))
-            return false;
+        WorkParallelForN(batchEnd - batchStart, [&](size_t begin, size_t end) {
+            std::vector<GfMatrix4d> xforms(samples.size());
+            for (size_t b = begin; b < end; ++b) {
+                // Get the transforms of just this joint.
+                const size_t jointIdx = batchStart + b;
+                for (size_t i = 0; i < samples.size(); ++i) {
+                    xforms[i] = samples[i].cdata()[jointIdx];
+                }
+
+                _DecomposeTransformAnim(xforms, applyEulerFilter, rotateOrders[b], &anims[b]);
+            }
+        });
+
+        for (size_t jointIdx = batchStart; jointIdx < batchEnd; ++jointIdx) {
+            if (!jointDep.setObject(jointNodes[jointIdx]))
+                continue;
+
+            if (!_SetTransformAnim(jointDep, anims[jointIdx - batchStart], mayaTimes, context))
+                return false;
+        }
     }
     return true;
 }
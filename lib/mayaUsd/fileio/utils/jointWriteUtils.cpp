@@ -56,6 +56,10 @@
 #include <maya/MStatus.h>
 #include <maya/MUintArray.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // clang-format off
@@ -67,6 +71,11 @@ TF_DEFINE_PRIVATE_TOKENS(
 );
 // clang-format on
 
+namespace {
+// The number of weights read from a skinCluster at once.
+constexpr unsigned int kSkinWeightsChunkSize = 1u << 20;
+} // namespace
+
 SdfPath UsdMayaJointUtil::getAnimationPath(const SdfPath& skelPath)
 {
     return skelPath.AppendChild(_tokens->Animation);
@@ -214,7 +223,8 @@ int UsdMayaJointUtil::getCompressedSkinWeights(
     const MFnMesh&        mesh,
     const MFnSkinCluster& skinCluster,
     VtIntArray*           usdJointIndices,
-    VtFloatArray*         usdJointWeights)
+    VtFloatArray*         usdJointWeights,
+    int                   maxInfluences)
 {
     // Get the single output dag path from the skin cluster.
     // Note that we can't get the dag path from the mesh because it's the input
@@ -229,70 +239,143 @@ int UsdMayaJointUtil::getCompressedSkinWeights(
         return 0;
     }
 
-    // Get all of the weights from the skinCluster in one batch.
-    unsigned int              numVertices = mesh.numVertices();
-    MFnSingleIndexedComponent components;
-    components.create(MFn::kMeshVertComponent);
-    components.setCompleteData(numVertices);
-    MDoubleArray weights;
-    unsigned int numInfluences;
-    skinCluster.getWeights(outputDagPath, components.object(), weights, numInfluences);
-
-    if (numInfluences <= 0) {
-        MString msg("No influences found for skinCluster ");
-        msg += skinCluster.name();
-        MGlobal::displayError(msg);
-        throw std::runtime_error(msg.asChar());
+    const unsigned int numVertices = mesh.numVertices();
+    if (numVertices == 0) {
+        return 0;
     }
 
-    if (weights.length() < numVertices * numInfluences) {
-        MString msg("The number of vertices on the exported mesh ");
-        msg += outputDagPath.partialPathName();
-        msg += "(";
-        msg += numVertices;
-
-        msg += ") do not match the number of vertices where the skinCluster was applied (";
-        msg += weights.length() / numInfluences;
-        msg += "). Remove any nodes that change mesh topology after the skinCluster.";
-
-        MGlobal::displayError(msg);
-        throw std::runtime_error(msg.asChar());
-    }
+    // The weights are read from the skinCluster in chunks of vertices, and only the non-zero
+    // weights of each vertex are kept, so that the dense vertices by influences matrix is never
+    // allocated.
+    //
+    // The influences of vertex v are at [influenceStarts[v], influenceStarts[v + 1]).
+    std::vector<size_t> influenceStarts(numVertices + 1, 0);
+    std::vector<int>    influenceIndices;
+    std::vector<float>  influenceWeights;
 
     // Determine how many influence/weight "slots" we actually need per point.
     // For example, if there are the joints /a, /a/b, and /a/c, but each point
     // only has non-zero weighting for a single joint, then we only need one
     // slot instead of three.
-    int maxInfluenceCount = 0;
-    for (unsigned int vert = 0; vert < numVertices; ++vert) {
-        // Looping through each vertex.
-        const unsigned int offset = vert * numInfluences;
-        int                influenceCount = 0;
-        for (unsigned int i = 0; i < numInfluences; ++i) {
-            // Looping through each weight for vertex.
-            if (weights[offset + i] != 0.0) {
-                influenceCount++;
+    int          maxInfluenceCount = 0;
+    unsigned int numInfluences = 0;
+    size_t       maxChunkWeights = 0;
+
+    std::vector<std::pair<int, double>> vertexInfluences;
+    for (unsigned int chunkStart = 0; chunkStart < numVertices;) {
+        // Size the chunks from the number of influences, once it is known.
+        const unsigned int chunkSize = numInfluences > 0
+            ? std::max(1u, kSkinWeightsChunkSize / numInfluences)
+            : std::min(numVertices, 1024u);
+        const unsigned int chunkEnd = std::min(numVertices, chunkStart + chunkSize);
+
+        MIntArray chunkVertices(chunkEnd - chunkStart);
+        for (unsigned int vert = chunkStart; vert < chunkEnd; ++vert) {
+            chunkVertices[vert - chunkStart] = vert;
+        }
+
+        MFnSingleIndexedComponent components;
+        components.create(MFn::kMeshVertComponent);
+        components.addElements(chunkVertices);
+        MDoubleArray weights;
+        skinCluster.getWeights(outputDagPath, components.object(), weights, numInfluences);
+
+        if (numInfluences <= 0) {
+            MString msg("No influences found for skinCluster ");
+            msg += skinCluster.name();
+            MGlobal::displayError(msg);
+            throw std::runtime_error(msg.asChar());
+        }
+
+        if (weights.length() < chunkVertices.length() * numInfluences) {
+            MString msg("The number of vertices on the exported mesh ");
+            msg += outputDagPath.partialPathName();
+            msg += "(";
+            msg += numVertices;
+
+            msg += ") do not match the number of vertices where the skinCluster was applied (";
+            msg += chunkStart + weights.length() / numInfluences;
+            msg += "). Remove any nodes that change mesh topology after the skinCluster.";
+
+            MGlobal::displayError(msg);
+            throw std::runtime_error(msg.asChar());
+        }
+        maxChunkWeights = std::max<size_t>(maxChunkWeights, weights.length());
+
+        for (unsigned int vert = chunkStart; vert < chunkEnd; ++vert) {
+            // Looping through each vertex.
+            const unsigned int offset = (vert - chunkStart) * numInfluences;
+            vertexInfluences.clear();
+            double totalWeight = 0.0;
+            for (unsigned int i = 0; i < numInfluences; ++i) {
+                // Looping through each weight for vertex.
+                if (weights[offset + i] != 0.0) {
+                    vertexInfluences.emplace_back(i, weights[offset + i]);
+                    totalWeight += weights[offset + i];
+                }
             }
+
+            // Only keep the largest weights, scaled so that their sum is unchanged.
+            double scale = 1.0;
+            if (maxInfluences > 0 && vertexInfluences.size() > size_t(maxInfluences)) {
+                const auto kept = vertexInfluences.begin() + maxInfluences;
+                std::partial_sort(
+                    vertexInfluences.begin(),
+                    kept,
+                    vertexInfluences.end(),
+                    [](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+                        return a.second > b.second || (a.second == b.second && a.first < b.first);
+                    });
+                vertexInfluences.erase(kept, vertexInfluences.end());
+                std::sort(vertexInfluences.begin(), vertexInfluences.end());
+
+                double keptWeight = 0.0;
+                for (const auto& influence : vertexInfluences) {
+                    keptWeight += influence.second;
+                }
+                if (keptWeight != 0.0) {
+                    scale = totalWeight / keptWeight;
+                }
+            }
+
+            maxInfluenceCount = std::max(maxInfluenceCount, int(vertexInfluences.size()));
+            for (const auto& influence : vertexInfluences) {
+                float weight = influence.second * scale;
+                if (!GfIsClose(weight, 0.0, 1e-8)) {
+                    influenceIndices.push_back(influence.first);
+                    influenceWeights.push_back(weight);
+                }
+            }
+            influenceStarts[vert + 1] = influenceIndices.size();
         }
-        maxInfluenceCount = std::max(maxInfluenceCount, influenceCount);
+
+        chunkStart = chunkEnd;
     }
 
     usdJointIndices->assign(maxInfluenceCount * numVertices, 0);
     usdJointWeights->assign(maxInfluenceCount * numVertices, 0.0);
     for (unsigned int vert = 0; vert < numVertices; ++vert) {
         // Looping through each vertex.
-        const unsigned int inputOffset = vert * numInfluences;
-        int                outputOffset = vert * maxInfluenceCount;
-        for (unsigned int i = 0; i < numInfluences; ++i) {
-            // Looping through each weight for vertex.
-            float weight = weights[inputOffset + i];
-            if (!GfIsClose(weight, 0.0, 1e-8)) {
-                (*usdJointIndices)[outputOffset] = i;
-                (*usdJointWeights)[outputOffset] = weight;
-                outputOffset++;
-            }
+        size_t outputOffset = size_t(vert) * maxInfluenceCount;
+        for (size_t i = influenceStarts[vert]; i < influenceStarts[vert + 1]; ++i) {
+            (*usdJointIndices)[outputOffset] = influenceIndices[i];
+            (*usdJointWeights)[outputOffset] = influenceWeights[i];
+            outputOffset++;
         }
     }
+
+    TF_DEBUG(PXRUSDMAYA_TRANSLATORS)
+        .Msg(
+            "Skin weights of %s: %u vertices, %u influences, %d kept per vertex. "
+            "Peak of %zu bytes instead of %zu bytes for all the weights.\n",
+            skinCluster.name().asChar(),
+            numVertices,
+            numInfluences,
+            maxInfluenceCount,
+            maxChunkWeights * sizeof(double) + influenceStarts.size() * sizeof(size_t)
+                + influenceIndices.size() * (sizeof(int) + sizeof(float)),
+            size_t(numVertices) * numInfluences * sizeof(double));
+
     return maxInfluenceCount;
 }
 
@@ -341,15 +424,16 @@ bool UsdMayaJointUtil::getGeomBindTransform(
 bool UsdMayaJointUtil::writeJointInfluences(
     const MFnSkinCluster&    skinCluster,
     const MFnMesh&           inMesh,
-    const UsdSkelBindingAPI& binding)
+    const UsdSkelBindingAPI& binding,
+    int                      maxInfluences)
 {
     // The data in the skinCluster is essentially already in the same format
     // as UsdSkel expects, but we're going to compress it by only outputting
     // the nonzero weights.
     VtIntArray   jointIndices;
     VtFloatArray jointWeights;
-    int          maxInfluenceCount
-        = getCompressedSkinWeights(inMesh, skinCluster, &jointIndices, &jointWeights);
+    int          maxInfluenceCount = getCompressedSkinWeights(
+        inMesh, skinCluster, &jointIndices, &jointWeights, maxInfluences);
 
     if (maxInfluenceCount <= 0)
         return false;
@@ -415,7 +499,8 @@ MObject UsdMayaJointUtil::writeSkinningData(
     const MDagPath&            dagPath,
     SdfPath&                   skelPath,
     const bool                 stripNamespaces,
-    FlexibleSparseValueWriter* valueWriter)
+    FlexibleSparseValueWriter* valueWriter,
+    int                        maxInfluences)
 {
     // Figure out if we even have a skin cluster in the first place.
     MObject skinClusterObj = UsdMayaJointUtil::getSkinCluster(dagPath);
@@ -461,7 +546,7 @@ MObject UsdMayaJointUtil::writeSkinningData(
     const UsdSkelBindingAPI bindingAPI
         = UsdMayaTranslatorUtil::GetAPISchemaForAuthoring<UsdSkelBindingAPI>(primSchema.GetPrim());
 
-    if (UsdMayaJointUtil::writeJointInfluences(skinCluster, inMesh, bindingAPI)) {
+    if (UsdMayaJointUtil::writeJointInfluences(skinCluster, inMesh, bindingAPI, maxInfluences)) {
         UsdMayaJointUtil::writeJointOrder(rootJoint, jointDagPaths, bindingAPI, stripNamespaces);
     }
 
@@ -101,12 +101,19 @@ MObject getInputMesh(const MFnSkinCluster& skinCluster);
 /// Gets skin weights, and compresses them into the form expected by
 /// UsdSkelBindingAPI, which allows us to omit zero-weight influences from the
 /// joint weights list.
+///
+/// The weights are read in chunks of vertices, so the memory used grows with
+/// the number of non-zero weights rather than with the number of vertices
+/// times the number of influences. If \p maxInfluences is positive, only the
+/// largest \p maxInfluences weights of each vertex are kept, scaled so that
+/// their sum is unchanged.
 MAYAUSD_CORE_PUBLIC
 int getCompressedSkinWeights(
     const MFnMesh&        mesh,
     const MFnSkinCluster& skinCluster,
     VtIntArray*           usdJointIndices,
-    VtFloatArray*         usdJointWeights);
+    VtFloatArray*         usdJointWeights,
+    int                   maxInfluences = 0);
 
 /// Check if a skinned primitive has an unsupported post-deformation
 /// transformation. These transformations aren't represented in UsdSkel.
@@ -140,12 +147,14 @@ bool getGeomBindTransform(const MFnSkinCluster& skinCluster, GfMatrix4d* geomBin
 MAYAUSD_CORE_PUBLIC
 MDagPath getRootJoint(const std::vector<MDagPath>& jointDagPaths);
 
-/// Compute and write joint influences.
+/// Compute and write joint influences, keeping at most \p maxInfluences per
+/// point if it is positive.
 MAYAUSD_CORE_PUBLIC
 bool writeJointInfluences(
     const MFnSkinCluster&    skinCluster,
     const MFnMesh&           inMesh,
-    const UsdSkelBindingAPI& binding);
+    const UsdSkelBindingAPI& binding,
+    int                      maxInfluences = 0);
 
 MAYAUSD_CORE_PUBLIC
 bool writeJointOrder(
@@ -170,7 +179,8 @@ MObject writeSkinningData(
     const MDagPath&            dagPath,
     SdfPath&                   skelPath,
     const bool                 stripNamespaces,
-    FlexibleSparseValueWriter* valueWriter);
+    FlexibleSparseValueWriter* valueWriter,
+    int                        maxInfluences = 0);
 } // namespace UsdMayaJointUtil
 
 PXR_NAMESPACE_CLOSE_SCOPE
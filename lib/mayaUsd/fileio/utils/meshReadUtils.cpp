@@ -49,7 +49,6 @@
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItMeshEdge.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPointArray.h>
@@ -57,6 +56,8 @@
 #include <maya/MStatus.h>
 #include <maya/MUintArray.h>
 
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_DEFINE_PUBLIC_TOKENS(UsdMayaMeshPrimvarTokens, PXRUSDMAYA_MESH_PRIMVAR_TOKENS);
@@ -165,32 +166,49 @@ MIntArray getMayaFaceVertexAssignmentIds(
 {
     MIntArray valueIds(meshFn.numFaceVertices(), -1);
 
-    MItMeshFaceVertex itFV(meshFn.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        int valueId = 0;
-        if (interpolation == UsdGeomTokens->constant) {
-            valueId = 0;
-        } else if (interpolation == UsdGeomTokens->uniform) {
-            valueId = itFV.faceId();
-        } else if (interpolation == UsdGeomTokens->vertex) {
-            valueId = itFV.vertId();
-        } else if (interpolation == UsdGeomTokens->faceVarying) {
-            valueId = fvi;
-        }
+    // Fetch the face-vertex topology in one call instead of walking the mesh
+    // with MItMeshFaceVertex, then fill the ids with a flat loop.
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    if (!meshFn.getVertices(faceVertexCounts, faceVertexIndices)
+        || faceVertexIndices.length() != valueIds.length() || valueIds.length() == 0u) {
+        return valueIds;
+    }
 
-        if (static_cast<size_t>(valueId) < assignmentIndices.size()) {
-            // The data is indexed, so consult the indices array for the
-            // correct index into the data.
-            valueId = assignmentIndices[valueId];
+    const bool isUniform = (interpolation == UsdGeomTokens->uniform);
+    const bool isVertex = (interpolation == UsdGeomTokens->vertex);
+    const bool isFaceVarying = (interpolation == UsdGeomTokens->faceVarying);
+
+    const int*   vertexIds = &faceVertexIndices[0];
+    int*         outIds = &valueIds[0];
+    const size_t numAssignments = assignmentIndices.size();
+
+    unsigned int fvi = 0;
+    for (unsigned int faceId = 0; faceId < faceVertexCounts.length(); ++faceId) {
+        const int faceVertexCount = faceVertexCounts[faceId];
+        for (int i = 0; i < faceVertexCount; ++i, ++fvi) {
+            int valueId = 0;
+            if (isUniform) {
+                valueId = faceId;
+            } else if (isVertex) {
+                valueId = vertexIds[fvi];
+            } else if (isFaceVarying) {
+                valueId = fvi;
+            }
 
-            if (valueId == unauthoredValuesIndex) {
-                // This component had no authored value, so leave it unassigned.
-                continue;
+            if (static_cast<size_t>(valueId) < numAssignments) {
+                // The data is indexed, so consult the indices array for the
+                // correct index into the data.
+                valueId = assignmentIndices[valueId];
+
+                if (valueId == unauthoredValuesIndex) {
+                    // This component had no authored value, so leave it unassigned.
+                    continue;
+                }
             }
-        }
 
-        valueIds[fvi] = valueId;
+            outIds[fvi] = valueId;
+        }
     }
 
     return valueIds;
@@ -566,6 +584,78 @@ bool assignConstantPrimvarToMesh(const UsdGeomPrimvar& primvar, MFnMesh& meshFn)
 }
 } // namespace
 
+void UsdMayaMeshReadUtils::readMeshData(
+    const UsdGeomMesh&   mesh,
+    const GfInterval&    frameRange,
+    UsdMayaMeshReadData* data)
+{
+    data->frameRange = frameRange;
+
+    // Note: topologically varying meshes are not supported, the caller reports them.
+    const UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
+    data->faceVertexCountsVarying = fvc.ValueMightBeTimeVarying();
+    if (!data->faceVertexCountsVarying) {
+        fvc.Get(&data->faceVertexCounts, UsdTimeCode::EarliestTime());
+    }
+
+    const UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
+    data->faceVertexIndicesVarying = fvi.ValueMightBeTimeVarying();
+    if (!data->faceVertexIndicesVarying) {
+        fvi.Get(&data->faceVertexIndices, UsdTimeCode::EarliestTime());
+    }
+
+    // If the USD mesh was left-handed, then the faces had their vertices in left-handed order.
+    // Fix them to be in right-handed order, as expected by Maya.
+    TfToken orientation;
+    if (mesh.GetOrientationAttr().Get(&orientation)
+        && orientation == UsdGeomTokens->leftHanded) {
+        VtIntArray& faceVertexIndices = data->faceVertexIndices;
+        size_t      firstIndex = 0;
+        for (int vertexCount : data->faceVertexCounts) {
+            if (firstIndex + vertexCount > faceVertexIndices.size()) {
+                break;
+            }
+            std::reverse(
+                faceVertexIndices.begin() + firstIndex,
+                faceVertexIndices.begin() + firstIndex + vertexCount);
+            firstIndex += vertexCount;
+        }
+    }
+
+    // Gather points and normals
+    // If timeInterval is non-empty, pick the first available sample in the
+    // timeInterval or default.
+    UsdTimeCode pointsTimeSample = UsdTimeCode::EarliestTime();
+    UsdTimeCode normalsTimeSample = UsdTimeCode::EarliestTime();
+
+    data->pointsTimeSamples.clear();
+    if (!frameRange.IsEmpty()) {
+        mesh.GetPointsAttr().GetTimeSamplesInInterval(frameRange, &data->pointsTimeSamples);
+        if (!data->pointsTimeSamples.empty()) {
+            pointsTimeSample = data->pointsTimeSamples.front();
+        }
+
+        std::vector<double> normalsTimeSamples;
+        mesh.GetNormalsAttr().GetTimeSamplesInInterval(frameRange, &normalsTimeSamples);
+        if (!normalsTimeSamples.empty()) {
+            normalsTimeSample = normalsTimeSamples.front();
+        }
+    }
+
+    mesh.GetPointsAttr().Get(&data->points, pointsTimeSample);
+
+    /* If 'normals' and 'primvars:normals' are both specified, the latter has precedence. */
+    UsdGeomPrimvar primvar = UsdGeomPrimvarsAPI(mesh).GetPrimvar(UsdGeomTokens->normals);
+
+    if (primvar.HasValue()) {
+        primvar.ComputeFlattened(&data->normals, normalsTimeSample);
+        data->normalsInterpolation = primvar.GetInterpolation();
+    } else {
+        mesh.GetNormalsAttr().Get(&data->normals, normalsTimeSample);
+        data->normalsInterpolation = mesh.GetNormalsInterpolation();
+    }
+}
+
 // This can be customized for specific pipelines.
 bool UsdMayaMeshReadUtils::getEmitNormalsTag(const MFnMesh& mesh, bool* value)
 {
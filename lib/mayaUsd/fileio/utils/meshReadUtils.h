@@ -20,10 +20,12 @@
 
 #include <mayaUsd/base/api.h>
 
+#include <pxr/base/gf/interval.h>
 #include <pxr/base/gf/vec3f.h>
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/vt/array.h>
+#include <pxr/base/vt/types.h>
 #include <pxr/pxr.h>
 #include <pxr/usd/usd/attribute.h>
 #include <pxr/usd/usdGeom/mesh.h>
@@ -65,8 +67,39 @@ TF_DECLARE_PUBLIC_TOKENS(
     MAYAUSD_CORE_PUBLIC,
     PXRUSDMAYA_GEOMSUBSET_TOKENS);
 
+/// \brief The USD data needed to create the Maya mesh of a UsdGeomMesh.
+///
+/// The data can be read ahead of the creation of the Maya mesh, which has to happen on the main
+/// thread, for example in parallel for all the meshes of an import.
+struct UsdMayaMeshReadData
+{
+    /// The frame range used to pick the points and normals time samples.
+    GfInterval frameRange;
+
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices; //!< In right-handed order
+    bool       faceVertexCountsVarying { false };
+    bool       faceVertexIndicesVarying { false };
+
+    VtVec3fArray        points;
+    VtVec3fArray        normals;
+    TfToken             normalsInterpolation;
+    std::vector<double> pointsTimeSamples;
+};
+
 /// Utilities for dealing with USD and RenderMan for Maya mesh/subdiv tags.
 namespace UsdMayaMeshReadUtils {
+
+/// Reads the USD data needed to create the Maya mesh of \p mesh into \p data. The points and
+/// normals are read at their first time sample in \p frameRange, if any.
+///
+/// Only USD is accessed, so this can be called from any thread.
+MAYAUSD_CORE_PUBLIC
+void readMeshData(
+    const UsdGeomMesh&   mesh,
+    const GfInterval&    frameRange,
+    UsdMayaMeshReadData* data);
+
 /// Gets the internal emit-normals tag on the Maya \p mesh, placing it in
 /// \p value. Returns true if the tag exists on the mesh, and false if not.
 MAYAUSD_CORE_PUBLIC
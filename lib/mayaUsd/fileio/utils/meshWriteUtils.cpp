@@ -49,7 +49,6 @@
 #include <maya/MGlobal.h>
 #include <maya/MIntArray.h>
 #include <maya/MItDependencyGraph.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MPlug.h>
 #include <maya/MPlugArray.h>
 #include <maya/MPoint.h>
@@ -920,21 +919,50 @@ bool UsdMayaMeshWriteUtils::getMeshUVSetData(
     assignmentIndices->assign(static_cast<size_t>(numFaceVertices), -1);
     *interpolation = UsdGeomTokens->faceVarying;
 
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0u;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        if (!itFV.hasUVs(uvSetName)) {
-            // No UVs for this faceVertex, so leave it unassigned.
+    // The assigned UV ids only cover the mapped faces, so walk the face sizes
+    // to place them at their face-vertex index. A face is either fully mapped
+    // or not mapped at all.
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    status = mesh.getVertices(faceVertexCounts, faceVertexIndices);
+    CHECK_MSTATUS_AND_RETURN(status, false);
+
+    if (faceVertexCounts.length() != uvCounts.length()) {
+        return false;
+    }
+
+    const int          numUVs = static_cast<int>(uArray.length());
+    const unsigned int numAssignedUVs = uvIds.length();
+    const int*         assignedUVs = &uvIds[0];
+    int*               indices = assignmentIndices->data();
+
+    unsigned int fvi = 0u;
+    unsigned int uvi = 0u;
+    for (unsigned int faceId = 0u; faceId < faceVertexCounts.length(); ++faceId) {
+        const int faceVertexCount = faceVertexCounts[faceId];
+        const int faceUVCount = uvCounts[faceId];
+        if (faceUVCount != 0 && faceUVCount != faceVertexCount) {
+            return false;
+        }
+
+        if (faceUVCount == 0) {
+            // No UVs for this face, so leave its face vertices unassigned.
+            fvi += faceVertexCount;
             continue;
         }
 
-        int uvIndex;
-        itFV.getUVIndex(uvIndex, &uvSetName);
-        if (uvIndex < 0 || static_cast<unsigned int>(uvIndex) >= uArray.length()) {
+        if (uvi + faceUVCount > numAssignedUVs || fvi + faceUVCount > numFaceVertices) {
             return false;
         }
 
-        (*assignmentIndices)[fvi] = uvIndex;
+        for (int i = 0; i < faceUVCount; ++i, ++fvi, ++uvi) {
+            const int uvIndex = assignedUVs[uvi];
+            if (uvIndex < 0 || uvIndex >= numUVs) {
+                return false;
+            }
+
+            indices[fvi] = uvIndex;
+        }
     }
 
     // We do not merge indexed values or compress indices here in an effort to
@@ -1280,113 +1308,128 @@ bool UsdMayaMeshWriteUtils::getMeshColorSetData(
     // vertices are initially unassigned/unauthored.
     colorSetRGBData->clear();
     colorSetAlphaData->clear();
+    colorSetRGBData->reserve((size_t)colorSetData.length());
+    colorSetAlphaData->reserve((size_t)colorSetData.length());
     colorSetAssignmentIndices->assign((size_t)colorSetData.length(), -1);
     *interpolation = UsdGeomTokens->faceVarying;
 
+    // Fetch the face sizes in one call instead of walking the mesh with
+    // MItMeshFaceVertex, so that the loop below only touches flat arrays.
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    if (mesh.getVertices(faceVertexCounts, faceVertexIndices) == MS::kFailure
+        || faceVertexIndices.length() != colorSetData.length()) {
+        return false;
+    }
+
+    MColor* colors = &colorSetData[0];
+    int*    assignmentIndices = colorSetAssignmentIndices->data();
+
     // Loop over every face vertex to populate the value arrays.
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        // If this is a displayColor color set, we may need to fallback on the
-        // bound shader colors/alphas for this face in some cases. In
-        // particular, if the color set is alpha-only, we fallback on the
-        // shader values for the color. If the color set is RGB-only, we
-        // fallback on the shader values for alpha only. If there's no authored
-        // color for this face vertex, we use both the color AND alpha values
-        // from the shader.
-        bool useShaderColorFallback = false;
-        bool useShaderAlphaFallback = false;
-        if (isDisplayColor) {
-            if (colorSetData[fvi] == unsetColor) {
-                useShaderColorFallback = true;
-                useShaderAlphaFallback = true;
-            } else if (*colorSetRep == MFnMesh::kAlpha) {
-                // The color set does not provide color, so fallback on shaders.
-                useShaderColorFallback = true;
-            } else if (*colorSetRep == MFnMesh::kRGB) {
-                // The color set does not provide alpha, so fallback on shaders.
-                useShaderAlphaFallback = true;
+    unsigned int fvi = 0;
+    for (int faceIndex = 0; faceIndex < static_cast<int>(faceVertexCounts.length()); ++faceIndex) {
+        const int faceVertexCount = faceVertexCounts[faceIndex];
+        for (int i = 0; i < faceVertexCount; ++i, ++fvi) {
+            // If this is a displayColor color set, we may need to fallback on the
+            // bound shader colors/alphas for this face in some cases. In
+            // particular, if the color set is alpha-only, we fallback on the
+            // shader values for the color. If the color set is RGB-only, we
+            // fallback on the shader values for alpha only. If there's no authored
+            // color for this face vertex, we use both the color AND alpha values
+            // from the shader.
+            bool useShaderColorFallback = false;
+            bool useShaderAlphaFallback = false;
+            if (isDisplayColor) {
+                if (colors[fvi] == unsetColor) {
+                    useShaderColorFallback = true;
+                    useShaderAlphaFallback = true;
+                } else if (*colorSetRep == MFnMesh::kAlpha) {
+                    // The color set does not provide color, so fallback on shaders.
+                    useShaderColorFallback = true;
+                } else if (*colorSetRep == MFnMesh::kRGB) {
+                    // The color set does not provide alpha, so fallback on shaders.
+                    useShaderAlphaFallback = true;
+                }
             }
-        }
 
-        // If we're exporting displayColor and we use the value from the color
-        // set, we need to convert it to linear.
-        bool convertDisplayColorToLinear = isDisplayColor;
-
-        // Shader values for the mesh could be constant
-        // (shadersAssignmentIndices is empty) or uniform.
-        int faceIndex = itFV.faceId();
-        if (useShaderColorFallback) {
-            // There was no color value in the color set to use, so we use the
-            // shader color, or the default color if there is no shader color.
-            // This color will already be in linear space, so don't convert it
-            // again.
-            convertDisplayColorToLinear = false;
-
-            int valueIndex = -1;
-            if (shadersAssignmentIndices.empty()) {
-                if (shadersRGBData.size() == 1) {
-                    valueIndex = 0;
-                }
-            } else if (
-                faceIndex >= 0
-                && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
+            // If we're exporting displayColor and we use the value from the color
+            // set, we need to convert it to linear.
+            bool convertDisplayColorToLinear = isDisplayColor;
+
+            // Shader values for the mesh could be constant
+            // (shadersAssignmentIndices is empty) or uniform.
+            if (useShaderColorFallback) {
+                // There was no color value in the color set to use, so we use the
+                // shader color, or the default color if there is no shader color.
+                // This color will already be in linear space, so don't convert it
+                // again.
+                convertDisplayColorToLinear = false;
+
+                int valueIndex = -1;
+                if (shadersAssignmentIndices.empty()) {
+                    if (shadersRGBData.size() == 1) {
+                        valueIndex = 0;
+                    }
+                } else if (
+                    faceIndex >= 0
+                    && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
 
-                int tmpIndex = shadersAssignmentIndices[faceIndex];
-                if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersRGBData.size()) {
-                    valueIndex = tmpIndex;
+                    int tmpIndex = shadersAssignmentIndices[faceIndex];
+                    if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersRGBData.size()) {
+                        valueIndex = tmpIndex;
+                    }
+                }
+                if (valueIndex >= 0) {
+                    colors[fvi][0] = shadersRGBData[valueIndex][0];
+                    colors[fvi][1] = shadersRGBData[valueIndex][1];
+                    colors[fvi][2] = shadersRGBData[valueIndex][2];
+                } else {
+                    // No shader color to fallback on. Use the default shader color.
+                    colors[fvi][0] = UnauthoredShaderRGB[0];
+                    colors[fvi][1] = UnauthoredShaderRGB[1];
+                    colors[fvi][2] = UnauthoredShaderRGB[2];
                 }
             }
-            if (valueIndex >= 0) {
-                colorSetData[fvi][0] = shadersRGBData[valueIndex][0];
-                colorSetData[fvi][1] = shadersRGBData[valueIndex][1];
-                colorSetData[fvi][2] = shadersRGBData[valueIndex][2];
-            } else {
-                // No shader color to fallback on. Use the default shader color.
-                colorSetData[fvi][0] = UnauthoredShaderRGB[0];
-                colorSetData[fvi][1] = UnauthoredShaderRGB[1];
-                colorSetData[fvi][2] = UnauthoredShaderRGB[2];
-            }
-        }
-        if (useShaderAlphaFallback) {
-            int valueIndex = -1;
-            if (shadersAssignmentIndices.empty()) {
-                if (shadersAlphaData.size() == 1) {
-                    valueIndex = 0;
+            if (useShaderAlphaFallback) {
+                int valueIndex = -1;
+                if (shadersAssignmentIndices.empty()) {
+                    if (shadersAlphaData.size() == 1) {
+                        valueIndex = 0;
+                    }
+                } else if (
+                    faceIndex >= 0
+                    && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
+                    int tmpIndex = shadersAssignmentIndices[faceIndex];
+                    if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersAlphaData.size()) {
+                        valueIndex = tmpIndex;
+                    }
                 }
-            } else if (
-                faceIndex >= 0
-                && static_cast<size_t>(faceIndex) < shadersAssignmentIndices.size()) {
-                int tmpIndex = shadersAssignmentIndices[faceIndex];
-                if (tmpIndex >= 0 && static_cast<size_t>(tmpIndex) < shadersAlphaData.size()) {
-                    valueIndex = tmpIndex;
+                if (valueIndex >= 0) {
+                    colors[fvi][3] = shadersAlphaData[valueIndex];
+                } else {
+                    // No shader alpha to fallback on. Use the default shader alpha.
+                    colors[fvi][3] = UnauthoredShaderAlpha;
                 }
             }
-            if (valueIndex >= 0) {
-                colorSetData[fvi][3] = shadersAlphaData[valueIndex];
-            } else {
-                // No shader alpha to fallback on. Use the default shader alpha.
-                colorSetData[fvi][3] = UnauthoredShaderAlpha;
-            }
-        }
 
-        // If we have a color/alpha value, add it to the data to be returned.
-        if (colorSetData[fvi] != unsetColor) {
-            GfVec3f rgbValue = UnauthoredColorSetRGB;
-            float   alphaValue = UnauthoredColorAlpha;
+            // If we have a color/alpha value, add it to the data to be returned.
+            if (colors[fvi] != unsetColor) {
+                GfVec3f rgbValue = UnauthoredColorSetRGB;
+                float   alphaValue = UnauthoredColorAlpha;
 
-            if (useShaderColorFallback || (*colorSetRep == MFnMesh::kRGB)
-                || (*colorSetRep == MFnMesh::kRGBA)) {
-                rgbValue = LinearColorFromColorSet(colorSetData[fvi], convertDisplayColorToLinear);
-            }
-            if (useShaderAlphaFallback || (*colorSetRep == MFnMesh::kAlpha)
-                || (*colorSetRep == MFnMesh::kRGBA)) {
-                alphaValue = colorSetData[fvi][3];
-            }
+                if (useShaderColorFallback || (*colorSetRep == MFnMesh::kRGB)
+                    || (*colorSetRep == MFnMesh::kRGBA)) {
+                    rgbValue = LinearColorFromColorSet(colors[fvi], convertDisplayColorToLinear);
+                }
+                if (useShaderAlphaFallback || (*colorSetRep == MFnMesh::kAlpha)
+                    || (*colorSetRep == MFnMesh::kRGBA)) {
+                    alphaValue = colors[fvi][3];
+                }
 
-            colorSetRGBData->push_back(rgbValue);
-            colorSetAlphaData->push_back(alphaValue);
-            (*colorSetAssignmentIndices)[fvi] = colorSetRGBData->size() - 1;
+                colorSetRGBData->push_back(rgbValue);
+                colorSetAlphaData->push_back(alphaValue);
+                assignmentIndices[fvi] = colorSetRGBData->size() - 1;
+            }
         }
     }
 
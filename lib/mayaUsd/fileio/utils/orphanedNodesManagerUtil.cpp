@@ -16,7 +16,6 @@
 #include "orphanedNodesManagerUtil.h"
 
 #include <maya/MGlobal.h>
-#include <ufe/trie.imp.h>
 
 namespace MAYAUSD_NS_DEF {
 namespace utils {
@@ -96,15 +95,15 @@ void toText(std::string& buf, const PullVariantInfo& variantInfo, int indent, bo
 }
 
 void toText(
-    std::string&                               buffer,
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    int                                        indent,
-    bool                                       eol)
+    std::string&                                     buffer,
+    const OrphanedNodesManager::PulledPrimNode::Ptr& trieNode,
+    int                                              indent,
+    bool                                             eol)
 {
     if (!trieNode)
         return;
 
-    const Ufe::TrieNode<PullVariantInfo>& node = *trieNode;
+    const OrphanedNodesManager::PulledPrimNode& node = *trieNode;
 
     toText(buffer, "", node.component().string(), indent, eol);
 
@@ -121,9 +120,9 @@ void toText(
 }
 
 void printOrphanedNodesManagerPullInfo(
-    const Ufe::TrieNode<PullVariantInfo>::Ptr& trieNode,
-    int                                        indent,
-    bool                                       eol)
+    const OrphanedNodesManager::PulledPrimNode::Ptr& trieNode,
+    int                                              indent,
+    bool                                             eol)
 {
     std::string buffer("Trie ==========================================\n");
     toText(buffer, trieNode, indent, eol);
@@ -40,15 +40,15 @@ void toText(
     bool                                         eol);
 
 void toText(
-    std::string&                                                     buffer,
-    const Ufe::TrieNode<OrphanedNodesManager::PullVariantInfo>::Ptr& trieNode,
-    int                                                              indent = 0,
-    bool                                                             eol = true);
+    std::string&                                     buffer,
+    const OrphanedNodesManager::PulledPrimNode::Ptr& trieNode,
+    int                                              indent = 0,
+    bool                                             eol = true);
 
 void printOrphanedNodesManagerPullInfo(
-    const Ufe::TrieNode<OrphanedNodesManager::PullVariantInfo>::Ptr& trieNode,
-    int                                                              indent = 0,
-    bool                                                             eol = true);
+    const OrphanedNodesManager::PulledPrimNode::Ptr& trieNode,
+    int                                              indent = 0,
+    bool                                             eol = true);
 
 } // namespace utils
 } // namespace MAYAUSD_NS_DEF
@@ -15,6 +15,7 @@
 //
 #include "layerManager.h"
 
+#include <mayaUsd/base/debugCodes.h>
 #include <mayaUsd/listeners/notice.h>
 #include <mayaUsd/listeners/proxyShapeNotice.h>
 #include <mayaUsd/nodes/proxyShapeBase.h>
@@ -25,7 +26,13 @@
 #include <mayaUsd/utils/utilFileSystem.h>
 #include <mayaUsd/utils/utilSerialization.h>
 
+#include <pxr/base/arch/fileSystem.h>
+#include <pxr/base/tf/debug.h>
+#include <pxr/base/tf/fastCompression.h>
+#include <pxr/base/tf/fileUtils.h>
 #include <pxr/base/tf/instantiateType.h>
+#include <pxr/base/tf/stopwatch.h>
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/weakBase.h>
 #include <pxr/usd/ar/resolver.h>
 #include <pxr/usd/sdf/textFileFormat.h>
@@ -55,8 +62,14 @@
 #include <ufe/observableSelection.h>
 #include <ufe/selectionNotification.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <memory>
 #include <set>
 
 namespace {
@@ -195,6 +208,171 @@ bool isCrashing()
 
 constexpr auto kSaveOptionUICmd = "usdFileSaveOptions(true);";
 
+// Layers serialized as compressed crate data start with this header, followed by the size of the
+// crate data on the first line and the base64 encoding of the LZ4 compressed data. Text layers
+// start with their own "#usda" or "#sdf" header, so the two cannot be confused.
+constexpr auto kCompressedCrateHeader = "#usdc_lz4 ";
+
+// LZ4 cannot compress data by more than this ratio, so larger crate sizes in the header are
+// invalid.
+constexpr size_t kMaxCompressionRatio = 255;
+
+// The temporary crate files of the layers loaded from the Maya file. The layers read their values
+// from these files on demand, so they are only deleted when a new scene is created or opened, when
+// the plugin is unloaded or when Maya exits.
+std::vector<std::string> crateTempFiles;
+
+std::string encodeBase64(const char* data, size_t size)
+{
+    static const char kChars[]
+        = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string encoded;
+    encoded.reserve((size + 2) / 3 * 4);
+    for (size_t i = 0; i < size; i += 3) {
+        const size_t   count = std::min<size_t>(size - i, 3);
+        const uint32_t bits = (uint32_t(uint8_t(data[i])) << 16)
+            | (count > 1 ? uint32_t(uint8_t(data[i + 1])) << 8 : 0)
+            | (count > 2 ? uint32_t(uint8_t(data[i + 2])) : 0);
+        encoded += kChars[(bits >> 18) & 63];
+        encoded += kChars[(bits >> 12) & 63];
+        encoded += count > 1 ? kChars[(bits >> 6) & 63] : '=';
+        encoded += count > 2 ? kChars[bits & 63] : '=';
+    }
+    return encoded;
+}
+
+bool decodeBase64(const char* encoded, size_t size, std::vector<char>* data)
+{
+    data->clear();
+    data->reserve(size / 4 * 3);
+
+    uint32_t bits = 0;
+    int      bitCount = 0;
+    for (size_t i = 0; i < size && encoded[i] != '='; ++i) {
+        const char c = encoded[i];
+        uint32_t   value = 0;
+        if (c >= 'A' && c <= 'Z') {
+            value = c - 'A';
+        } else if (c >= 'a' && c <= 'z') {
+            value = c - 'a' + 26;
+        } else if (c >= '0' && c <= '9') {
+            value = c - '0' + 52;
+        } else if (c == '+') {
+            value = 62;
+        } else if (c == '/') {
+            value = 63;
+        } else {
+            return false;
+        }
+        bits = (bits << 6) | value;
+        bitCount += 6;
+        if (bitCount >= 8) {
+            bitCount -= 8;
+            data->push_back(char((bits >> bitCount) & 0xFF));
+        }
+    }
+    return true;
+}
+
+// Serializes the layer as LZ4 compressed crate data. The crate data is written by the usdc file
+// format, which only writes to files, so the layer is exported to a temporary file.
+bool exportToCompressedCrate(const SdfLayerHandle& layer, std::string* serialized)
+{
+    const std::string tempFile = ArchMakeTmpFileName("mayaUsdLayer", ".usdc");
+    std::vector<char> crate;
+    bool              exported = layer->Export(tempFile);
+    if (exported) {
+        std::ifstream file(tempFile, std::ios::binary | std::ios::ate);
+        crate.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        exported = file.read(crate.data(), crate.size()).good();
+    }
+    TfDeleteFile(tempFile);
+    if (!exported || crate.size() > TfFastCompression::GetMaxInputSize()) {
+        return false;
+    }
+
+    std::unique_ptr<char[]> compressed(
+        new char[TfFastCompression::GetCompressedBufferSize(crate.size())]);
+    const size_t compressedSize
+        = TfFastCompression::CompressToBuffer(crate.data(), compressed.get(), crate.size());
+    if (compressedSize == 0 && !crate.empty()) {
+        return false;
+    }
+
+    *serialized = kCompressedCrateHeader + std::to_string(crate.size()) + '\n'
+        + encodeBase64(compressed.get(), compressedSize);
+    return true;
+}
+
+// Decompresses the serialized crate data to a temporary file and returns its path, or an empty
+// string if the data is invalid.
+std::string writeCompressedCrate(const std::string& serialized)
+{
+    const size_t headerSize = strlen(kCompressedCrateHeader);
+    const size_t endOfLine = serialized.find('\n', headerSize);
+    if (endOfLine == std::string::npos) {
+        return {};
+    }
+    char*        endOfSize = nullptr;
+    const size_t crateSize = std::strtoull(serialized.c_str() + headerSize, &endOfSize, 10);
+    if (endOfSize != serialized.c_str() + endOfLine || crateSize == 0
+        || crateSize > TfFastCompression::GetMaxInputSize()) {
+        return {};
+    }
+
+    std::vector<char> compressed;
+    if (!decodeBase64(
+            serialized.data() + endOfLine + 1, serialized.size() - endOfLine - 1, &compressed)) {
+        return {};
+    }
+    if (crateSize / kMaxCompressionRatio > compressed.size()) {
+        return {};
+    }
+    std::unique_ptr<char[]> crate(new char[crateSize]);
+    if (TfFastCompression::DecompressFromBuffer(
+            compressed.data(), crate.get(), compressed.size(), crateSize)
+        != crateSize) {
+        return {};
+    }
+
+    const std::string tempFile = ArchMakeTmpFileName("mayaUsdLayer", ".usdc");
+    std::ofstream     file(tempFile, std::ios::binary);
+    if (!file.write(crate.get(), crateSize)) {
+        file.close();
+        TfDeleteFile(tempFile);
+        return {};
+    }
+    crateTempFiles.push_back(tempFile);
+    return tempFile;
+}
+
+// Replaces the content of the layer with the crate data of the file. Layers whose format reads
+// crate files load the values on demand from the file, others receive a copy of the data.
+bool importCrate(const SdfLayerRefPtr& layer, const std::string& crateFile)
+{
+    if (layer->GetFileFormat()->CanRead(crateFile)) {
+        return layer->Import(crateFile);
+    }
+    SdfLayerRefPtr crateLayer = SdfLayer::OpenAsAnonymous(crateFile);
+    if (!crateLayer) {
+        return false;
+    }
+    layer->TransferContent(crateLayer);
+    return true;
+}
+
+void deleteCrateTempFiles()
+{
+    // Files that are still in use cannot be deleted on some platforms, they are tried again later.
+    auto notDeleted = std::remove_if(
+        crateTempFiles.begin(), crateTempFiles.end(), [](const std::string& tempFile) {
+            return TfDeleteFile(tempFile);
+        });
+    crateTempFiles.erase(notDeleted, crateTempFiles.end());
+}
+
 } // namespace
 
 namespace MAYAUSD_NS_DEF {
@@ -215,6 +393,7 @@ public:
     static void           cleanupForWrite();
     static void           loadLayersPostRead(void*);
     static void           cleanUpNewScene(void*);
+    static void           cleanUpMayaExiting(void*);
     static void           clearManagerNode(MayaUsd::LayerManager* lm);
     static void           removeManagerNode(MayaUsd::LayerManager* lm = nullptr);
 
@@ -267,6 +446,7 @@ private:
     static MCallbackId                    postExportCallbackId;
     static MCallbackId                    postNewCallbackId;
     static MCallbackId                    preOpenCallbackId;
+    static MCallbackId                    mayaExitingCallbackId;
 
     static MayaUsd::BatchSaveDelegate _batchSaveDelegate;
 
@@ -279,6 +459,7 @@ MCallbackId LayerDatabase::preExportCallbackId = 0;
 MCallbackId LayerDatabase::postExportCallbackId = 0;
 MCallbackId LayerDatabase::postNewCallbackId = 0;
 MCallbackId LayerDatabase::preOpenCallbackId = 0;
+MCallbackId LayerDatabase::mayaExitingCallbackId = 0;
 
 MayaUsd::BatchSaveDelegate LayerDatabase::_batchSaveDelegate = nullptr;
 
@@ -305,6 +486,7 @@ LayerDatabase::~LayerDatabase()
     }
 
     unregisterCallbacks();
+    deleteCrateTempFiles();
 }
 
 void LayerDatabase::registerCallbacks()
@@ -322,6 +504,8 @@ void LayerDatabase::registerCallbacks()
             = MSceneMessage::addCallback(MSceneMessage::kAfterNew, LayerDatabase::cleanUpNewScene);
         preOpenCallbackId = MSceneMessage::addCallback(
             MSceneMessage::kBeforeOpen, LayerDatabase::cleanUpNewScene);
+        mayaExitingCallbackId = MSceneMessage::addCallback(
+            MSceneMessage::kMayaExiting, LayerDatabase::cleanUpMayaExiting);
     }
 }
 
@@ -334,6 +518,7 @@ void LayerDatabase::unregisterCallbacks()
         MSceneMessage::removeCallback(postExportCallbackId);
         MSceneMessage::removeCallback(postNewCallbackId);
         MSceneMessage::removeCallback(preOpenCallbackId);
+        MSceneMessage::removeCallback(mayaExitingCallbackId);
 
         preSaveCallbackId = 0;
         postSaveCallbackId = 0;
@@ -341,6 +526,7 @@ void LayerDatabase::unregisterCallbacks()
         postExportCallbackId = 0;
         postNewCallbackId = 0;
         preOpenCallbackId = 0;
+        mayaExitingCallbackId = 0;
     }
 }
 
@@ -351,7 +537,15 @@ void LayerDatabase::addSupportForNodeType(MTypeId type)
     }
 }
 
-void LayerDatabase::removeSupportForNodeType(MTypeId type) { _supportedTypes.erase(type.id()); }
+void LayerDatabase::removeSupportForNodeType(MTypeId type)
+{
+    _supportedTypes.erase(type.id());
+
+    // The plugin is being unloaded, so its layers are not in use anymore.
+    if (_supportedTypes.empty()) {
+        deleteCrateTempFiles();
+    }
+}
 
 bool LayerDatabase::supportedNodeType(MTypeId type)
 {
@@ -676,9 +870,24 @@ MStatus addLayerToBuilder(
 
     std::string temp;
     if (!stubOnly && ((exportOnlyIfDirty && layer->IsDirty()) || !exportOnlyIfDirty)) {
-        if (!layer->ExportToString(&temp)) {
+        TfStopwatch watch;
+        watch.Start();
+
+        // Fall back to text if the layer cannot be written as crate data.
+        const bool binary = MayaUsd::utils::serializeUsdEditsAsBinaryOption()
+            && exportToCompressedCrate(layer, &temp);
+        if (!binary && !layer->ExportToString(&temp)) {
             status = MS::kFailure;
         }
+
+        watch.Stop();
+        TF_DEBUG(USDMAYA_LAYER_SERIALIZATION)
+            .Msg(
+                "Serialized layer '%s' as %s: %zu bytes in %.1f ms\n",
+                layer->GetIdentifier().c_str(),
+                binary ? "compressed crate" : "text",
+                temp.size(),
+                watch.GetSeconds() * 1000.0);
     }
 
     serializedHandle.setString(UsdMayaUtil::convert(temp));
@@ -972,12 +1181,32 @@ void LayerDatabase::loadLayersPostRead(void*)
             layerContainsEdits = false;
         }
 
+        TfStopwatch watch;
+        watch.Start();
+
+        // Compressed crate data is decompressed to a temporary file, from which the layer then
+        // reads its values on demand.
+        std::string crateFile;
+        if (TfStringStartsWith(serializedVal, kCompressedCrateHeader)) {
+            crateFile = writeCompressedCrate(serializedVal);
+            if (crateFile.empty()) {
+                MGlobal::displayError(
+                    MString("Failed to decode serialized layer: ") + identifierVal.c_str());
+                continue;
+            }
+        }
+
         bool isAnon = anonymousPlug.asBool(MDGContext::fsNormal, &status);
         if (isAnon) {
             // Note that the new identifier will not match the old identifier - only the "tag"
             // will be retained
-            layer
-                = SdfLayer::CreateAnonymous(SdfLayer::GetDisplayNameFromIdentifier(identifierVal));
+            const std::string tag = SdfLayer::GetDisplayNameFromIdentifier(identifierVal);
+            if (!crateFile.empty()) {
+                layer = SdfLayer::OpenAsAnonymous(crateFile, false, tag);
+                layerContainsEdits = false;
+            } else {
+                layer = SdfLayer::CreateAnonymous(tag);
+            }
         } else {
             SdfLayerHandle layerHandle = SdfLayer::Find(identifierVal);
             if (layerHandle) {
@@ -1025,13 +1254,28 @@ void LayerDatabase::loadLayersPostRead(void*)
 
         if (layer) {
             if (layerContainsEdits) {
-                if (!layer->ImportFromString(serializedVal)) {
+                if (!crateFile.empty()) {
+                    if (!importCrate(layer, crateFile)) {
+                        MGlobal::displayError(
+                            MString("Failed to import serialized layer: ") + identifierVal.c_str());
+                        continue;
+                    }
+                } else if (!layer->ImportFromString(serializedVal)) {
                     MGlobal::displayError(
                         MString("Failed to import serialized layer: ") + serializedVal.c_str());
                     continue;
                 }
             }
 
+            watch.Stop();
+            TF_DEBUG(USDMAYA_LAYER_SERIALIZATION)
+                .Msg(
+                    "Loaded layer '%s' from %s: %zu bytes in %.1f ms\n",
+                    identifierVal.c_str(),
+                    crateFile.empty() ? "text" : "compressed crate",
+                    serializedVal.size(),
+                    watch.GetSeconds() * 1000.0);
+
             LayerDatabase::instance().addLayer(layer, identifierVal);
             createdLayers.push_back(layer);
         }
@@ -1054,6 +1298,13 @@ void LayerDatabase::cleanUpNewScene(void*)
     OpUndoItemMuting muting;
     LayerDatabase::instance().removeAllLayers();
     LayerDatabase::removeManagerNode();
+    deleteCrateTempFiles();
+}
+
+void LayerDatabase::cleanUpMayaExiting(void*)
+{
+    LayerDatabase::instance().removeAllLayers();
+    deleteCrateTempFiles();
 }
 
 bool LayerDatabase::remapSubLayerPaths(SdfLayerHandle parentLayer)
@@ -29,7 +29,7 @@
 #include <pxr/usd/usd/prim.h>
 #include <pxr/usd/usd/stage.h>
 #include <pxr/usd/usd/timeCode.h>
-#include <pxr/usd/usdGeom/pointBased.h>
+#include <pxr/usd/usdGeom/tokens.h>
 
 #include <maya/MDataBlock.h>
 #include <maya/MDataHandle.h>
@@ -146,10 +146,8 @@ MStatus UsdMayaPointBasedDeformerNode::deform(
     }
 
     const SdfPath primPath(primPathString);
-
-    const UsdPrim&          usdPrim = usdStage->GetPrimAtPath(primPath);
-    const UsdGeomPointBased usdPointBased(usdPrim);
-    if (!usdPointBased) {
+    if (!primPath.IsPrimPath()
+        || !_pointsCache.SetAttribute(usdStage, primPath.AppendProperty(UsdGeomTokens->points))) {
         return MS::kFailure;
     }
 
@@ -162,7 +160,7 @@ MStatus UsdMayaPointBasedDeformerNode::deform(
     const float envelope = envelopeHandle.asFloat();
 
     VtVec3fArray usdPoints;
-    if (!usdPointBased.GetPointsAttr().Get(&usdPoints, usdTime) || usdPoints.empty()) {
+    if (!_pointsCache.Get(usdTime, &usdPoints) || usdPoints.empty()) {
         return MS::kFailure;
     }
 
@@ -17,6 +17,7 @@
 #define PXRUSDMAYA_POINT_BASED_DEFORMER_NODE_H
 
 #include <mayaUsd/base/api.h>
+#include <mayaUsd/utils/vec3fArraySampleCache.h>
 
 #include <pxr/base/tf/staticTokens.h>
 #include <pxr/pxr.h>
@@ -86,6 +87,10 @@ private:
 
     UsdMayaPointBasedDeformerNode(const UsdMayaPointBasedDeformerNode&);
     UsdMayaPointBasedDeformerNode& operator=(const UsdMayaPointBasedDeformerNode&);
+
+    // Keeps the points attribute query across evaluations, and reads the upcoming samples ahead
+    // during playback.
+    UsdMayaVec3fArraySampleCache _pointsCache;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
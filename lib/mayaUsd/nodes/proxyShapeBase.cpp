@@ -241,6 +241,21 @@ private:
     MayaUsdProxyShapeBase& _proxy;
 };
 
+TfTokenVector getPurposes(bool drawRenderPurpose, bool drawProxyPurpose, bool drawGuidePurpose)
+{
+    TfTokenVector purposes { UsdGeomTokens->default_ };
+    if (drawRenderPurpose) {
+        purposes.push_back(UsdGeomTokens->render);
+    }
+    if (drawProxyPurpose) {
+        purposes.push_back(UsdGeomTokens->proxy);
+    }
+    if (drawGuidePurpose) {
+        purposes.push_back(UsdGeomTokens->guide);
+    }
+    return purposes;
+}
+
 } // namespace
 
 /* static */
@@ -1221,7 +1236,8 @@ MStatus MayaUsdProxyShapeBase::computeOutStageData(MDataBlock& dataBlock)
 
     const bool isNormalContext = dataBlock.context().isNormal();
     if (isNormalContext) {
-        TfReset(_boundingBoxCache);
+        _boundingBoxCache.Clear();
+        _rayIntersector.Clear();
 
         // Reset the stage listener until we determine that everything is valid.
         _stageNoticeListener.SetStage(UsdStageWeakPtr());
@@ -1496,17 +1512,12 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
     dataBlock.inputValue(outStageDataAttr, &status);
     CHECK_MSTATUS_AND_RETURN(status, MBoundingBox());
 
-    // XXX:
-    // If we could cheaply determine whether a stage only has static geometry,
-    // we could make this value a constant one for that case, avoiding the
-    // memory overhead of a cache entry per frame
+    // The bounding boxes are cached per time code, up to a fixed number of time codes. The
+    // bounds of the static parts of the stage are shared between all of them.
     UsdTimeCode currTime = GetOutputTime(dataBlock);
 
-    std::map<UsdTimeCode, MBoundingBox>::const_iterator cacheLookup
-        = _boundingBoxCache.find(currTime);
-
-    if (cacheLookup != _boundingBoxCache.end()) {
-        return cacheLookup->second;
+    if (const MBoundingBox* cached = nonConstThis->_boundingBoxCache.Find(currTime)) {
+        return *cached;
     }
 
     MProfilingScope profilingScope(
@@ -1517,22 +1528,17 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
         return MBoundingBox();
     }
 
-    const UsdGeomImageable imageablePrim(prim);
-
     bool drawRenderPurpose = false;
     bool drawProxyPurpose = true;
     bool drawGuidePurpose = false;
     _GetDrawPurposeToggles(dataBlock, &drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
 
-    const TfToken purpose1 = UsdGeomTokens->default_;
-    const TfToken purpose2 = drawRenderPurpose ? UsdGeomTokens->render : TfToken();
-    const TfToken purpose3 = drawProxyPurpose ? UsdGeomTokens->proxy : TfToken();
-    const TfToken purpose4 = drawGuidePurpose ? UsdGeomTokens->guide : TfToken();
+    const TfTokenVector purposes
+        = getPurposes(drawRenderPurpose, drawProxyPurpose, drawGuidePurpose);
 
+    // Includes the Maya-specific extents, such as the ones of cameras.
     GfBBox3d allBox
-        = imageablePrim.ComputeUntransformedBound(currTime, purpose1, purpose2, purpose3, purpose4);
-
-    UsdMayaUtil::AddMayaExtents(allBox, prim, currTime);
+        = nonConstThis->_boundingBoxCache.ComputeUntransformedBound(prim, currTime, purposes);
 
 #if defined(WANT_UFE_BUILD)
     Ufe::BBox3d pulledUfeBBox = ufe::getPulledPrimsBoundingBox(ufePath());
@@ -1544,7 +1550,7 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
     }
 #endif
 
-    MBoundingBox& retval = nonConstThis->_boundingBoxCache[currTime];
+    MBoundingBox retval;
 
     const GfRange3d boxRange = allBox.ComputeAlignedBox();
 
@@ -1558,10 +1564,10 @@ MBoundingBox MayaUsdProxyShapeBase::boundingBox() const
         nonConstThis->CacheEmptyBoundingBox(retval);
     }
 
-    return retval;
+    return nonConstThis->_boundingBoxCache.Insert(currTime, retval);
 }
 
-void MayaUsdProxyShapeBase::clearBoundingBoxCache() { _boundingBoxCache.clear(); }
+void MayaUsdProxyShapeBase::clearBoundingBoxCache() { _boundingBoxCache.Clear(); }
 
 bool MayaUsdProxyShapeBase::isStageValid() const
 {
@@ -2057,10 +2063,10 @@ void MayaUsdProxyShapeBase::_OnStageObjectsChanged(const UsdNotice::ObjectsChang
     }
 #endif
 
-    // This will definitely force a BBox recomputation on "Frame All" or when framing a selected
-    // stage. Computing bounds in USD is expensive, so if it pops up in other frequently used
-    // scenarios we will have to investigate ways to make this cache clearing less expensive.
-    clearBoundingBoxCache();
+    // Only the parts of the bounds cache that contain the changed prims are recomputed on the
+    // next "Frame All" or when framing a selected stage.
+    _boundingBoxCache.Invalidate(notice);
+    _rayIntersector.Invalidate(notice);
 
     ProxyAccessor::stageChanged(_usdAccessor, thisMObject(), notice);
     MayaUsdProxyStageObjectsChangedNotice(*this, notice).Send();
@@ -2158,6 +2164,40 @@ bool MayaUsdProxyShapeBase::closestPoint(
 
 bool MayaUsdProxyShapeBase::canMakeLive() const { return (bool)_sharedClosestPointDelegate; }
 
+bool MayaUsdProxyShapeBase::intersectRay(
+    const GfRay& ray,
+    GfVec3d*     outClosestPoint,
+    GfVec3d*     outClosestNormal) const
+{
+    MProfilingScope profilerScope(
+        _shapeBaseProfilerCategory, MProfiler::kColorE_L3, "Intersect ray");
+
+    const UsdPrim prim = usdPrim();
+    if (!prim) {
+        return false;
+    }
+
+    bool drawRenderPurpose = false;
+    bool drawProxyPurpose = true;
+    bool drawGuidePurpose = false;
+    getDrawPurposeToggles(&drawRenderPurpose, &drawProxyPurpose, &drawGuidePurpose);
+
+    const TfTokenVector purposes
+        = getPurposes(drawRenderPurpose, drawProxyPurpose, drawGuidePurpose);
+
+    MayaUsdProxyShapeBase* nonConstThis = const_cast<ThisClass*>(this);
+    nonConstThis->_rayIntersector.SetExcludePrimPaths(getExcludePrimPaths());
+
+    UsdMayaStageRayIntersector::Hit hit;
+    if (!nonConstThis->_rayIntersector.IntersectRay(prim, getTime(), purposes, ray, &hit)) {
+        return false;
+    }
+
+    *outClosestPoint = hit.point;
+    *outClosestNormal = hit.normal;
+    return true;
+}
+
 void _proxyShapeAncestorPlugDirty(MObject& node, MPlug& plug, void* clientData)
 {
     auto proxyShape = static_cast<MayaUsdProxyShapeBase*>(clientData);
@@ -55,8 +55,10 @@ constexpr char USD_UFE_SEPARATOR = '/';
 #include <mayaUsd/base/api.h>
 #include <mayaUsd/listeners/stageNoticeListener.h>
 #include <mayaUsd/nodes/proxyAccessor.h>
+#include <mayaUsd/nodes/proxyShapeBoundsCache.h>
 #include <mayaUsd/nodes/proxyStageProvider.h>
 #include <mayaUsd/nodes/usdPrimProvider.h>
+#include <mayaUsd/utils/stageRayIntersector.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -204,6 +206,13 @@ public:
     MAYAUSD_CORE_PUBLIC
     bool canMakeLive() const override;
 
+    /// Computes the closest intersection of \p ray with the meshes of the stage, using the
+    /// current time and draw purposes of the shape. The ray, point and normal are in the local
+    /// space of the shape. Unlike the closest point delegate of the GL batch renderer, this does
+    /// not need a viewport, which makes it usable in batch mode.
+    MAYAUSD_CORE_PUBLIC
+    bool intersectRay(const GfRay& ray, GfVec3d* outClosestPoint, GfVec3d* outClosestNormal) const;
+
     // Public functions
     MAYAUSD_CORE_PUBLIC
     virtual SdfPathVector getExcludePrimPaths() const;
@@ -414,7 +423,8 @@ private:
 
     UsdMayaStageNoticeListener _stageNoticeListener;
 
-    std::map<UsdTimeCode, MBoundingBox> _boundingBoxCache;
+    MayaUsdProxyShapeBoundsCache _boundingBoxCache;
+    UsdMayaStageRayIntersector   _rayIntersector;
     size_t                              _excludePrimPathsVersion { 1 };
     size_t                              _UsdStageVersion { 1 };
 
@@ -0,0 +1,312 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "proxyShapeBoundsCache.h"
+
+#include <mayaUsd/utils/util.h>
+
+#include <pxr/base/trace/trace.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/boundable.h>
+#include <pxr/usd/usdGeom/imageable.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
+#include <pxr/usd/usdGeom/tokens.h>
+
+#include <algorithm>
+#include <deque>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+MayaUsdProxyShapeBoundsCache::MayaUsdProxyShapeBoundsCache(size_t maxCachedTimes, size_t maxCells)
+    : _maxCachedTimes(std::max<size_t>(maxCachedTimes, 1))
+    , _maxCells(std::max<size_t>(maxCells, 1))
+{
+}
+
+MayaUsdProxyShapeBoundsCache::~MayaUsdProxyShapeBoundsCache() = default;
+
+const MBoundingBox* MayaUsdProxyShapeBoundsCache::Find(const UsdTimeCode& time)
+{
+    auto found = _boundingBoxIndex.find(time);
+    if (found == _boundingBoxIndex.end()) {
+        return nullptr;
+    }
+
+    // Move the entry to the front, as the most recently used one.
+    _boundingBoxes.splice(_boundingBoxes.begin(), _boundingBoxes, found->second);
+    return &found->second->second;
+}
+
+const MBoundingBox&
+MayaUsdProxyShapeBoundsCache::Insert(const UsdTimeCode& time, const MBoundingBox& box)
+{
+    auto found = _boundingBoxIndex.find(time);
+    if (found != _boundingBoxIndex.end()) {
+        _boundingBoxes.splice(_boundingBoxes.begin(), _boundingBoxes, found->second);
+        found->second->second = box;
+        return found->second->second;
+    }
+
+    while (_boundingBoxes.size() >= _maxCachedTimes) {
+        _boundingBoxIndex.erase(_boundingBoxes.back().first);
+        _boundingBoxes.pop_back();
+    }
+
+    _boundingBoxes.emplace_front(time, box);
+    _boundingBoxIndex.emplace(time, _boundingBoxes.begin());
+    return _boundingBoxes.front().second;
+}
+
+void MayaUsdProxyShapeBoundsCache::ClearBoundingBoxes()
+{
+    _boundingBoxes.clear();
+    _boundingBoxIndex.clear();
+}
+
+void MayaUsdProxyShapeBoundsCache::Clear()
+{
+    ClearBoundingBoxes();
+
+    _cells.clear();
+    _cellIndex.clear();
+    _xformCache.reset();
+    _stage = UsdStageWeakPtr();
+    _rootPath = SdfPath();
+    _purposes.clear();
+    _cellsValid = false;
+}
+
+bool MayaUsdProxyShapeBoundsCache::_CanSplit(const UsdPrim& prim) const
+{
+    // The bound of a prim can be computed as the union of the bounds of its children when the
+    // prim does not contribute anything itself, and does not change how its children are
+    // included. Anything else is left to UsdGeomBBoxCache.
+    if (prim.IsPseudoRoot()) {
+        return true;
+    }
+
+    if (!prim.IsA<UsdGeomImageable>() || prim.IsA<UsdGeomBoundable>() || prim.IsInstance()
+        || prim.IsInstanceProxy()) {
+        return false;
+    }
+
+    if (prim.IsModel() && UsdGeomModelAPI(prim).GetExtentsHintAttr().HasAuthoredValue()) {
+        return false;
+    }
+
+    const UsdGeomImageable imageable(prim);
+
+    const UsdAttribute visibilityAttr = imageable.GetVisibilityAttr();
+    TfToken            visibility;
+    if (visibilityAttr.ValueMightBeTimeVarying()
+        || (visibilityAttr.Get(&visibility) && visibility != UsdGeomTokens->inherited)) {
+        return false;
+    }
+
+    const UsdAttribute purposeAttr = imageable.GetPurposeAttr();
+    TfToken            purpose;
+    if (purposeAttr.Get(&purpose) && purpose != UsdGeomTokens->default_) {
+        return false;
+    }
+
+    return true;
+}
+
+void MayaUsdProxyShapeBoundsCache::_BuildCells(const UsdPrim& root)
+{
+    TRACE_FUNCTION();
+
+    _cells.clear();
+    _cellIndex.clear();
+    _xformCache.reset(new UsdGeomXformCache());
+
+    // Split breadth first, so that the cells are as even as possible when the cell budget is
+    // reached. UsdGeomBBoxCache skips the children that are not imageable, but they are still
+    // kept as cells to be scanned for Maya extents.
+    std::vector<UsdPrim> cellPrims;
+    std::deque<UsdPrim>  candidates { root };
+    while (!candidates.empty()) {
+        const UsdPrim prim = candidates.front();
+        candidates.pop_front();
+
+        if (prim != root && !prim.IsA<UsdGeomImageable>()) {
+            cellPrims.push_back(prim);
+            continue;
+        }
+
+        if (_CanSplit(prim)) {
+            const auto children = prim.GetChildren();
+            const auto numChildren
+                = static_cast<size_t>(std::distance(children.begin(), children.end()));
+            if (cellPrims.size() + candidates.size() + numChildren <= _maxCells) {
+                candidates.insert(candidates.end(), children.begin(), children.end());
+                continue;
+            }
+        }
+
+        cellPrims.push_back(prim);
+    }
+
+    _cells.resize(cellPrims.size());
+    for (size_t i = 0; i < cellPrims.size(); ++i) {
+        _Cell& cell = _cells[i];
+        cell._path = cellPrims[i].GetPath();
+        cell._imageable = (cellPrims[i] == root) || cellPrims[i].IsA<UsdGeomImageable>();
+        cell._bboxCache.reset(new UsdGeomBBoxCache(
+            UsdTimeCode::Default(), _purposes, /* useExtentsHint = */ true));
+        _cellIndex.emplace(cell._path, i);
+    }
+
+    _cellsValid = true;
+}
+
+void MayaUsdProxyShapeBoundsCache::_InvalidateCell(_Cell& cell)
+{
+    cell._bboxCache->Clear();
+    cell._mayaExtentPaths.clear();
+    cell._scanned = false;
+}
+
+bool MayaUsdProxyShapeBoundsCache::_InvalidatePath(const SdfPath& changedPath, bool resynced)
+{
+    const SdfPath primPath = changedPath.GetPrimPath();
+
+    // Changes outside of the root subtree, other than on the ancestors of the root, do not
+    // affect the bounds.
+    if (!primPath.HasPrefix(_rootPath) && !_rootPath.HasPrefix(primPath)) {
+        return false;
+    }
+
+    // Clear the cell containing the changed prim. A resync of the cell itself may have removed
+    // or renamed it, so it needs the cells to be rebuilt.
+    for (SdfPath path = primPath; path.HasPrefix(_rootPath); path = path.GetParentPath()) {
+        auto found = _cellIndex.find(path);
+        if (found != _cellIndex.end()) {
+            if (resynced && path == primPath) {
+                _cellsValid = false;
+            } else {
+                _InvalidateCell(_cells[found->second]);
+            }
+            return true;
+        }
+
+        if (path == _rootPath) {
+            break;
+        }
+    }
+
+    // The change is on the root, on one of its ancestors, or on a prim above the cells.
+    _cellsValid = false;
+    return true;
+}
+
+void MayaUsdProxyShapeBoundsCache::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    TRACE_FUNCTION();
+
+    // Even without cells, the bounding boxes may have been cached before the stage changed.
+    bool changed = !_cellsValid;
+
+    if (_cellsValid) {
+        for (const SdfPath& path : notice.GetResyncedPaths()) {
+            changed |= _InvalidatePath(path, true);
+        }
+        for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+            changed |= _InvalidatePath(path, false);
+        }
+    }
+
+    if (changed) {
+        ClearBoundingBoxes();
+        if (_xformCache) {
+            _xformCache->Clear();
+        }
+    }
+}
+
+GfBBox3d MayaUsdProxyShapeBoundsCache::ComputeUntransformedBound(
+    const UsdPrim&       root,
+    const UsdTimeCode&   time,
+    const TfTokenVector& purposes)
+{
+    TRACE_FUNCTION();
+
+    if (!root) {
+        return GfBBox3d();
+    }
+
+    if (root.GetStage() != _stage || root.GetPath() != _rootPath || purposes != _purposes) {
+        Clear();
+        _stage = root.GetStage();
+        _rootPath = root.GetPath();
+        _purposes = purposes;
+    }
+
+    if (!_cellsValid) {
+        _BuildCells(root);
+    }
+
+    _xformCache->SetTime(time);
+
+    GfBBox3d bound;
+    for (_Cell& cell : _cells) {
+        const UsdPrim cellPrim
+            = (cell._path == _rootPath) ? root : _stage->GetPrimAtPath(cell._path);
+        if (!cellPrim) {
+            continue;
+        }
+
+        if (cell._imageable) {
+            // Time-varying entries are the only ones recomputed when the time changes.
+            cell._bboxCache->SetTime(time);
+            bound = GfBBox3d::Combine(
+                bound,
+                (cellPrim == root) ? cell._bboxCache->ComputeUntransformedBound(root)
+                                   : cell._bboxCache->ComputeRelativeBound(cellPrim, root));
+        }
+
+        if (!cell._scanned) {
+            for (const UsdPrim& prim : UsdPrimRange(cellPrim)) {
+                GfRange3d localExtent;
+                if (UsdMayaUtil::GetMayaExtent(prim, localExtent)) {
+                    cell._mayaExtentPaths.push_back(prim.GetPath());
+                }
+            }
+            cell._scanned = true;
+        }
+
+        for (const SdfPath& path : cell._mayaExtentPaths) {
+            const UsdPrim prim = _stage->GetPrimAtPath(path);
+            GfRange3d     localExtent;
+            if (!prim || !UsdMayaUtil::GetMayaExtent(prim, localExtent)) {
+                continue;
+            }
+
+            if (prim == root) {
+                bound = GfBBox3d::Combine(bound, GfBBox3d(localExtent));
+                continue;
+            }
+
+            bool             resetXformStack = false;
+            const GfMatrix4d xform
+                = _xformCache->ComputeRelativeTransform(prim, root, &resetXformStack);
+            bound = GfBBox3d::Combine(bound, GfBBox3d(localExtent, xform));
+        }
+    }
+
+    return bound;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
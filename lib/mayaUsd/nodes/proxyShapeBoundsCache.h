@@ -0,0 +1,119 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef MAYAUSD_PROXY_SHAPE_BOUNDS_CACHE_H
+#define MAYAUSD_PROXY_SHAPE_BOUNDS_CACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
+#include <pxr/usd/usdGeom/bboxCache.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+
+#include <maya/MBoundingBox.h>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class MayaUsdProxyShapeBoundsCache
+/// \brief Persistent bounds cache behind MayaUsdProxyShapeBase::boundingBox().
+///
+/// The subtree under the proxy shape root prim is split into cells, each with a UsdGeomBBoxCache
+/// that is kept across time changes. When its time changes, a UsdGeomBBoxCache only recomputes
+/// the entries that are time-varying, so the bounds of static subtrees are computed once for all
+/// times. A change notice only clears the cells that contain the changed prims; a change on the
+/// root or on a prim above the cells rebuilds all of them.
+///
+/// The resulting Maya bounding boxes are kept per time code, up to a maximum number of time
+/// codes after which the least recently used one is evicted.
+class MAYAUSD_CORE_PUBLIC MayaUsdProxyShapeBoundsCache
+{
+public:
+    MayaUsdProxyShapeBoundsCache(size_t maxCachedTimes = 256, size_t maxCells = 1024);
+    ~MayaUsdProxyShapeBoundsCache();
+
+    MayaUsdProxyShapeBoundsCache(const MayaUsdProxyShapeBoundsCache&) = delete;
+    MayaUsdProxyShapeBoundsCache& operator=(const MayaUsdProxyShapeBoundsCache&) = delete;
+
+    /// \brief Returns the bounding box cached for \p time, or nullptr if there is none.
+    const MBoundingBox* Find(const UsdTimeCode& time);
+
+    /// \brief Caches \p box for \p time and returns the cached copy.
+    const MBoundingBox& Insert(const UsdTimeCode& time, const MBoundingBox& box);
+
+    /// \brief Computes the bound of the subtree under \p root, in the space of \p root, for the
+    /// given purposes. Maya-specific extents, such as the ones of cameras, are included.
+    GfBBox3d ComputeUntransformedBound(
+        const UsdPrim&       root,
+        const UsdTimeCode&   time,
+        const TfTokenVector& purposes);
+
+    /// \brief Invalidates the cells affected by the changes in \p notice, along with all the
+    /// cached bounding boxes.
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
+    /// \brief Clears everything.
+    void Clear();
+
+    /// \brief Removes the cached bounding boxes, but keeps the cells.
+    void ClearBoundingBoxes();
+
+    /// \brief Returns the number of cells the root subtree is currently split into.
+    size_t GetNumCells() const { return _cells.size(); }
+
+private:
+    struct _Cell
+    {
+        SdfPath                           _path;
+        std::unique_ptr<UsdGeomBBoxCache> _bboxCache;
+        SdfPathVector                     _mayaExtentPaths;    //!< Prims with Maya-only extents
+        bool                              _imageable { true }; //!< False if only scanned
+        bool                              _scanned { false };
+    };
+
+    bool _CanSplit(const UsdPrim& prim) const;
+    void _BuildCells(const UsdPrim& root);
+    void _InvalidateCell(_Cell& cell);
+    bool _InvalidatePath(const SdfPath& changedPath, bool resynced);
+
+    using _BoundingBoxes = std::list<std::pair<UsdTimeCode, MBoundingBox>>;
+
+    _BoundingBoxes                                     _boundingBoxes; //!< Most recent first
+    std::map<UsdTimeCode, _BoundingBoxes::iterator>    _boundingBoxIndex;
+    std::vector<_Cell>                                 _cells;
+    std::unordered_map<SdfPath, size_t, SdfPath::Hash> _cellIndex;
+    std::unique_ptr<UsdGeomXformCache>                 _xformCache;
+    UsdStageWeakPtr                                    _stage;
+    SdfPath                                            _rootPath;
+    TfTokenVector                                      _purposes;
+    const size_t                                       _maxCachedTimes;
+    const size_t                                       _maxCells;
+    bool                                               _cellsValid { false };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // MAYAUSD_PROXY_SHAPE_BOUNDS_CACHE_H
@@ -44,6 +44,7 @@ TF_WRAP_MODULE
     TF_WRAP(ReadUtil);
     TF_WRAP(RoundTripUtil);
     TF_WRAP(StageCache);
+    TF_WRAP(StageRayIntersector);
     TF_WRAP(Tokens);
     TF_WRAP(TranslatorUtil);
     TF_WRAP(UsdUndoManager);
@@ -528,6 +528,7 @@ void wrapJobExportArgs()
         .add_property(
             "exportSkin",
             make_getter(&UsdMayaJobExportArgs::exportSkin, return_value_policy<return_by_value>()))
+        .def_readonly("maxJointInfluences", &UsdMayaJobExportArgs::maxJointInfluences)
         .def_readonly("exportVisibility", &UsdMayaJobExportArgs::exportVisibility)
         .def_readonly("file", &UsdMayaJobExportArgs::file)
         .add_property(
@@ -582,6 +583,7 @@ void wrapJobExportArgs()
             "shadingMode",
             make_getter(&UsdMayaJobExportArgs::shadingMode, return_value_policy<return_by_value>()))
         .def_readonly("staticSingleSample", &UsdMayaJobExportArgs::staticSingleSample)
+        .def_readonly("contextEvaluation", &UsdMayaJobExportArgs::contextEvaluation)
         .def_readonly("stripNamespaces", &UsdMayaJobExportArgs::stripNamespaces)
         .def_readonly("worldspace", &UsdMayaJobExportArgs::worldspace)
         .add_property(
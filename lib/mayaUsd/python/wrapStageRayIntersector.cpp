@@ -0,0 +1,121 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <mayaUsd/utils/stageRayIntersector.h>
+
+#include <pxr/base/tf/pyContainerConversions.h>
+#include <pxr/base/tf/pyLock.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/usd/pyConversions.h>
+
+#include <boost/python.hpp>
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+
+#include <limits>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+object _IntersectRay(
+    UsdMayaStageRayIntersector& self,
+    const UsdPrim&              root,
+    const UsdTimeCode&          time,
+    const TfTokenVector&        purposes,
+    const GfRay&                ray)
+{
+    UsdMayaStageRayIntersector::Hit hit;
+    if (!self.IntersectRay(root, time, purposes, ray, &hit)) {
+        return object();
+    }
+    return object(hit);
+}
+
+list _IntersectRays(
+    UsdMayaStageRayIntersector& self,
+    const UsdPrim&              root,
+    const UsdTimeCode&          time,
+    const TfTokenVector&        purposes,
+    const object&               pyRays)
+{
+    std::vector<GfRay> rays;
+    rays.reserve(len(pyRays));
+    for (ssize_t i = 0; i < len(pyRays); ++i) {
+        rays.push_back(extract<GfRay>(pyRays[i]));
+    }
+
+    // The rays are intersected in parallel, without holding the GIL.
+    std::vector<UsdMayaStageRayIntersector::Hit> hits;
+    {
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        self.IntersectRays(root, time, purposes, rays, &hits);
+    }
+
+    list result;
+    for (const UsdMayaStageRayIntersector::Hit& hit : hits) {
+        result.append(hit.primPath.IsEmpty() ? object() : object(hit));
+    }
+    return result;
+}
+
+object _FindClosestPoint(
+    UsdMayaStageRayIntersector& self,
+    const UsdPrim&              root,
+    const UsdTimeCode&          time,
+    const TfTokenVector&        purposes,
+    const GfVec3d&              point,
+    double                      maxDistance)
+{
+    UsdMayaStageRayIntersector::Hit hit;
+    if (!self.FindClosestPoint(root, time, purposes, point, &hit, maxDistance)) {
+        return object();
+    }
+    return object(hit);
+}
+
+} // namespace
+
+void wrapStageRayIntersector()
+{
+    typedef UsdMayaStageRayIntersector This;
+
+    class_<This, boost::noncopyable> c("StageRayIntersector", init<>());
+    c.def(init<size_t>(arg("maxCachedTimes")))
+        .def("IntersectRay", _IntersectRay, (arg("root"), arg("time"), arg("purposes"), arg("ray")))
+        .def(
+            "IntersectRays",
+            _IntersectRays,
+            (arg("root"), arg("time"), arg("purposes"), arg("rays")))
+        .def(
+            "FindClosestPoint",
+            _FindClosestPoint,
+            (arg("root"),
+             arg("time"),
+             arg("purposes"),
+             arg("point"),
+             arg("maxDistance") = std::numeric_limits<double>::max()))
+        .def("SetExcludePrimPaths", &This::SetExcludePrimPaths, arg("excludePrimPaths"))
+        .def("Clear", &This::Clear);
+
+    scope s(c);
+    class_<This::Hit>("Hit", no_init)
+        .def_readonly("primPath", &This::Hit::primPath)
+        .def_readonly("point", &This::Hit::point)
+        .def_readonly("normal", &This::Hit::normal)
+        .def_readonly("distance", &This::Hit::distance);
+}
@@ -23,12 +23,20 @@
 #include <pxr/base/gf/ray.h>
 #include <pxr/base/gf/rotation.h>
 #include <pxr/base/gf/vec3d.h>
+#include <pxr/base/tf/envSetting.h>
 #include <pxr/base/tf/registryManager.h>
 
 #include <maya/MFnDagNode.h>
+#include <maya/MGlobal.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    MAYAUSD_CPU_CLOSEST_POINT,
+    false,
+    "Always compute the closest point on proxy shapes on the CPU, instead of picking with the "
+    "GL batch renderer when it draws the shape.");
+
 static PxrMayaHdPrimFilter _sharedPrimFilter = {
     nullptr,
     HdRprimCollection(
@@ -38,13 +46,20 @@ static PxrMayaHdPrimFilter _sharedPrimFilter = {
 };
 
 /// Delegate for computing a ray intersection against a MayaUsdProxyShapeBase by
-/// rendering using Hydra via the UsdMayaGLBatchRenderer.
+/// rendering using Hydra via the UsdMayaGLBatchRenderer. When there is no viewport,
+/// or when the shape is not drawn by the batch renderer, the intersection is
+/// computed on the CPU instead.
 bool UsdMayaGL_ClosestPointOnProxyShape(
     const MayaUsdProxyShapeBase& shape,
     const GfRay&                 ray,
     GfVec3d*                     outClosestPoint,
     GfVec3d*                     outClosestNormal)
 {
+    if (TfGetEnvSetting(MAYAUSD_CPU_CLOSEST_POINT)
+        || MGlobal::mayaState() != MGlobal::kInteractive) {
+        return shape.intersectRay(ray, outClosestPoint, outClosestNormal);
+    }
+
     MStatus          status;
     const MFnDagNode dagNodeFn(shape.thisMObject(), &status);
     CHECK_MSTATUS_AND_RETURN(status, false);
@@ -53,11 +68,11 @@ bool UsdMayaGL_ClosestPointOnProxyShape(
     status = dagNodeFn.getPath(shapeDagPath);
     CHECK_MSTATUS_AND_RETURN(status, false);
 
-    // Try to populate our shared collection with the shape. If we can't, then
-    // we must bail.
+    // Try to populate our shared collection with the shape. If we can't, the
+    // shape is drawn by another renderer, such as the VP2 render delegate.
     UsdMayaGLBatchRenderer& renderer = UsdMayaGLBatchRenderer::GetInstance();
     if (!renderer.PopulateCustomPrimFilter(shapeDagPath, _sharedPrimFilter)) {
-        return false;
+        return shape.intersectRay(ray, outClosestPoint, outClosestNormal);
     }
 
     // Since we're just using the existing shape adapters, we'll compute
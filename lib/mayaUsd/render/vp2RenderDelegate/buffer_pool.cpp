@@ -0,0 +1,245 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "buffer_pool.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+size_t _IndexTypeSize(MHWRender::MGeometry::DataType type)
+{
+    return type == MHWRender::MGeometry::kUnsignedInt16 ? sizeof(unsigned short)
+                                                        : sizeof(unsigned int);
+}
+
+} // namespace
+
+/*! \brief  Return a vertex buffer with the given layout, reusing a pooled one if available.
+
+    The returned buffer is owned by the caller until released back to the pool.
+*/
+HdVP2BufferPool::VertexBufferPtr HdVP2BufferPool::AcquireVertexBuffer(
+    const MHWRender::MVertexBufferDescriptor& desc,
+    unsigned int                              vertexCount)
+{
+    const VertexBucketKey key(desc.semantic(), desc.dataType(), desc.dimension(), vertexCount);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _vertexBuckets.find(key);
+        if (it != _vertexBuckets.end() && !it->second.empty()) {
+            PooledVertexBuffer& pooled = it->second.back();
+            VertexBufferPtr     buffer = std::move(pooled._buffer);
+            _stats._pooledBytes -= pooled._bytes;
+            --_stats._pooledBufferCount;
+            it->second.pop_back();
+            ++_stats._hitCount;
+            return buffer;
+        }
+
+        ++_stats._missCount;
+    }
+
+    return VertexBufferPtr(new MHWRender::MVertexBuffer(desc));
+}
+
+/*! \brief  Return a vertex buffer to the pool. It becomes available for reuse after EndFrame().
+ */
+void HdVP2BufferPool::ReleaseVertexBuffer(VertexBufferPtr&& buffer)
+{
+    if (!buffer)
+        return;
+
+    const MHWRender::MVertexBufferDescriptor& desc = buffer->descriptor();
+    const unsigned int                        vertexCount = buffer->vertexCount();
+
+    const VertexBucketKey key(desc.semantic(), desc.dataType(), desc.dimension(), vertexCount);
+    const size_t          bytes
+        = static_cast<size_t>(vertexCount) * desc.dimension() * desc.dataTypeSize();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pendingVertexBuffers.emplace_back(key, PooledVertexBuffer { std::move(buffer), bytes });
+}
+
+/*! \brief  Return an index buffer of the given type, reusing a pooled one if available.
+
+    The returned buffer is owned by the caller until released back to the pool.
+*/
+HdVP2BufferPool::IndexBufferPtr
+HdVP2BufferPool::AcquireIndexBuffer(MHWRender::MGeometry::DataType type)
+{
+    const IndexBucketKey key = type;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _indexBuckets.find(key);
+        if (it != _indexBuckets.end() && !it->second.empty()) {
+            PooledIndexBuffer& pooled = it->second.back();
+            IndexBufferPtr     buffer = std::move(pooled._buffer);
+            _stats._pooledBytes -= pooled._bytes;
+            --_stats._pooledBufferCount;
+            it->second.pop_back();
+            ++_stats._hitCount;
+            return buffer;
+        }
+
+        ++_stats._missCount;
+    }
+
+    return IndexBufferPtr(new MHWRender::MIndexBuffer(type));
+}
+
+/*! \brief  Return an index buffer to the pool. It becomes available for reuse after EndFrame().
+ */
+void HdVP2BufferPool::ReleaseIndexBuffer(IndexBufferPtr&& buffer)
+{
+    if (!buffer)
+        return;
+
+    const MHWRender::MGeometry::DataType type = buffer->dataType();
+
+    const IndexBucketKey key = type;
+    const size_t         bytes = static_cast<size_t>(buffer->size()) * _IndexTypeSize(type);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pendingIndexBuffers.emplace_back(key, PooledIndexBuffer { std::move(buffer), bytes });
+}
+
+/*! \brief  Make buffers released during the frame available for reuse.
+
+    Must be called on main-thread once all commit tasks of the frame are executed, so none
+    of the released buffers is still bound to a render item.
+*/
+void HdVP2BufferPool::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Buckets are kept ordered from the least to the most recently released buffer.
+    for (auto& pending : _pendingVertexBuffers) {
+        _stats._pooledBytes += pending.second._bytes;
+        ++_stats._pooledBufferCount;
+        pending.second._lastUse = _useCount++;
+        _vertexBuckets[pending.first].push_back(std::move(pending.second));
+    }
+    _pendingVertexBuffers.clear();
+
+    for (auto& pending : _pendingIndexBuffers) {
+        _stats._pooledBytes += pending.second._bytes;
+        ++_stats._pooledBufferCount;
+        pending.second._lastUse = _useCount++;
+        _indexBuckets[pending.first].push_back(std::move(pending.second));
+    }
+    _pendingIndexBuffers.clear();
+
+    _stats._highWaterMarkBytes = std::max(_stats._highWaterMarkBytes, _stats._pooledBytes);
+
+    _TrimToBudget();
+}
+
+/*! \brief  Delete all the pooled buffers.
+ */
+void HdVP2BufferPool::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _vertexBuckets.clear();
+    _indexBuckets.clear();
+    _pendingVertexBuffers.clear();
+    _pendingIndexBuffers.clear();
+    _stats._pooledBytes = 0;
+    _stats._pooledBufferCount = 0;
+}
+
+/*! \brief  Set the memory budget of the pooled buffers. Excess buffers are deleted at EndFrame().
+ */
+void HdVP2BufferPool::SetMaxPooledBytes(size_t maxBytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _maxPooledBytes = maxBytes;
+}
+
+/*! \brief  Return the memory budget of the pooled buffers.
+ */
+size_t HdVP2BufferPool::GetMaxPooledBytes() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _maxPooledBytes;
+}
+
+/*! \brief  Return a snapshot of the pool statistics.
+ */
+HdVP2BufferPoolStats HdVP2BufferPool::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+/*! \brief  Delete the least recently released buffers until the pool fits its memory budget.
+
+    Must be called with _mutex locked.
+*/
+void HdVP2BufferPool::_TrimToBudget()
+{
+    if (_stats._pooledBytes <= _maxPooledBytes)
+        return;
+
+    // Find the most recent release to delete, so that the remaining buffers fit the budget.
+    std::vector<std::pair<size_t, size_t>> uses; // (last use, bytes)
+    uses.reserve(_stats._pooledBufferCount);
+    for (const auto& bucket : _vertexBuckets) {
+        for (const auto& pooled : bucket.second) {
+            uses.emplace_back(pooled._lastUse, pooled._bytes);
+        }
+    }
+    for (const auto& bucket : _indexBuckets) {
+        for (const auto& pooled : bucket.second) {
+            uses.emplace_back(pooled._lastUse, pooled._bytes);
+        }
+    }
+    std::sort(uses.begin(), uses.end());
+
+    size_t remainingBytes = _stats._pooledBytes;
+    size_t lastEvictedUse = 0;
+    for (const auto& use : uses) {
+        if (remainingBytes <= _maxPooledBytes)
+            break;
+        remainingBytes -= use.second;
+        lastEvictedUse = use.first;
+    }
+
+    // The buffers released up to that point are at the front of their bucket.
+    auto trimBuckets = [this, lastEvictedUse](auto& buckets) {
+        for (auto& bucket : buckets) {
+            auto& buffers = bucket.second;
+            auto  it = buffers.begin();
+            for (; it != buffers.end() && it->_lastUse <= lastEvictedUse; ++it) {
+                _stats._pooledBytes -= it->_bytes;
+                --_stats._pooledBufferCount;
+            }
+            buffers.erase(buffers.begin(), it);
+        }
+    };
+    trimBuckets(_vertexBuckets);
+    trimBuckets(_indexBuckets);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,130 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_BUFFER_POOL
+#define HD_VP2_BUFFER_POOL
+
+#include <pxr/pxr.h>
+
+#include <maya/MHWGeometry.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Statistics of the VP2 buffer pool.
+    \struct HdVP2BufferPoolStats
+*/
+struct HdVP2BufferPoolStats
+{
+    size_t _pooledBufferCount { 0 }; //!< Number of buffers available for reuse
+    size_t _pooledBytes { 0 };       //!< Memory held by the buffers available for reuse
+    size_t _highWaterMarkBytes { 0 }; //!< Highest value reached by _pooledBytes
+    size_t _hitCount { 0 };          //!< Number of acquisitions served by a pooled buffer
+    size_t _missCount { 0 };         //!< Number of acquisitions which allocated a new buffer
+
+    //! Ratio of acquisitions served by a pooled buffer, in [0, 1].
+    double HitRate() const
+    {
+        const size_t total = _hitCount + _missCount;
+        return total ? static_cast<double>(_hitCount) / total : 0.0;
+    }
+};
+
+/*! \brief  Size-bucketed pool of VP2 vertex and index buffers, owned by the render delegate.
+    \class  HdVP2BufferPool
+
+    Rprims release the buffers they no longer need to the pool instead of deleting them, and
+    acquire buffers from the pool instead of allocating new ones. Vertex buffers are bucketed
+    by layout (semantic, data type, dimension) and vertex count, so a vertex buffer is only
+    reused when it holds the same amount of data. Index buffers are created before their
+    index count is known and are bucketed by data type only.
+
+    Released buffers may still be bound to a render item until the next commit, so they only
+    become available for reuse after EndFrame() is called, once the commit is complete. When
+    the pooled buffers exceed the memory budget, the least recently released ones are deleted.
+
+    Acquire and release are thread safe and can be called from Sync on worker threads.
+*/
+class HdVP2BufferPool
+{
+public:
+    using VertexBufferPtr = std::unique_ptr<MHWRender::MVertexBuffer>;
+    using IndexBufferPtr = std::unique_ptr<MHWRender::MIndexBuffer>;
+
+    HdVP2BufferPool() = default;
+    ~HdVP2BufferPool() = default;
+
+    VertexBufferPtr AcquireVertexBuffer(
+        const MHWRender::MVertexBufferDescriptor& desc,
+        unsigned int                              vertexCount);
+    void ReleaseVertexBuffer(VertexBufferPtr&& buffer);
+
+    IndexBufferPtr AcquireIndexBuffer(MHWRender::MGeometry::DataType type);
+    void           ReleaseIndexBuffer(IndexBufferPtr&& buffer);
+
+    void EndFrame();
+    void Clear();
+
+    void   SetMaxPooledBytes(size_t maxBytes);
+    size_t GetMaxPooledBytes() const;
+
+    HdVP2BufferPoolStats GetStats() const;
+
+private:
+    HdVP2BufferPool(const HdVP2BufferPool&) = delete;
+    HdVP2BufferPool& operator=(const HdVP2BufferPool&) = delete;
+
+    //! (semantic, data type, dimension, vertex count)
+    using VertexBucketKey = std::tuple<int, int, int, unsigned int>;
+    //! data type
+    using IndexBucketKey = int;
+
+    //! A buffer held by the pool, along with the memory it holds.
+    template <typename BufferPtr> struct PooledBuffer
+    {
+        BufferPtr _buffer;
+        size_t    _bytes;
+        size_t    _lastUse { 0 }; //!< Order in which the buffer became available for reuse
+    };
+    using PooledVertexBuffer = PooledBuffer<VertexBufferPtr>;
+    using PooledIndexBuffer = PooledBuffer<IndexBufferPtr>;
+
+    void _TrimToBudget();
+
+    mutable std::mutex _mutex; //!< Protects all the members below
+
+    std::map<VertexBucketKey, std::vector<PooledVertexBuffer>> _vertexBuckets;
+    std::map<IndexBucketKey, std::vector<PooledIndexBuffer>>   _indexBuckets;
+
+    //! Buffers released during the current frame, not yet available for reuse.
+    std::vector<std::pair<VertexBucketKey, PooledVertexBuffer>> _pendingVertexBuffers;
+    std::vector<std::pair<IndexBucketKey, PooledIndexBuffer>>   _pendingIndexBuffers;
+
+    size_t _maxPooledBytes { 256 * 1024 * 1024 }; //!< Memory budget of the pooled buffers
+    size_t _useCount { 0 }; //!< Number of buffers which became available for reuse so far
+
+    HdVP2BufferPoolStats _stats;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif
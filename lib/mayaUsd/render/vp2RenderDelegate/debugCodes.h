@@ -21,7 +21,7 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-TF_DEBUG_CODES(HDVP2_DEBUG_MATERIAL, HDVP2_DEBUG_MESH);
+TF_DEBUG_CODES(HDVP2_DEBUG_MATERIAL, HDVP2_DEBUG_MESH, HDVP2_DEBUG_COMMIT);
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
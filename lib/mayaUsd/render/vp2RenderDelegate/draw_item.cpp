@@ -46,14 +46,19 @@ HdVP2DrawItem::~HdVP2DrawItem()
     if (_delegate) {
         auto* const         param = static_cast<HdVP2RenderParam*>(_delegate->GetRenderParam());
         MSubSceneContainer* subSceneContainer = param ? param->GetContainer() : nullptr;
-        if (subSceneContainer) {
-            for (const auto& renderItemData : _renderItems) {
-                const auto& sharedRenderItemCounter = renderItemData._sharedRenderItemCounter;
-                if (!sharedRenderItemCounter || (--(*sharedRenderItemCounter)) == 0) {
-                    TF_VERIFY(renderItemData._renderItemName == renderItemData._renderItem->name());
-                    subSceneContainer->remove(renderItemData._renderItem->name());
-                }
+        HdVP2BufferPool&    bufferPool = _delegate->GetVP2BufferPool();
+        for (auto& renderItemData : _renderItems) {
+            const auto& sharedRenderItemCounter = renderItemData._sharedRenderItemCounter;
+            if (sharedRenderItemCounter && (--(*sharedRenderItemCounter)) > 0) {
+                // The render item is still used by other draw items and may still be bound to
+                // this index buffer, so it cannot be recycled.
+                continue;
             }
+            if (subSceneContainer) {
+                TF_VERIFY(renderItemData._renderItemName == renderItemData._renderItem->name());
+                subSceneContainer->remove(renderItemData._renderItem->name());
+            }
+            bufferPool.ReleaseIndexBuffer(std::move(renderItemData._indexBuffer));
         }
     }
 }
@@ -73,8 +78,13 @@ HdVP2DrawItem::AddRenderItem(MHWRender::MRenderItem* item, const HdGeomSubset* g
         renderItemData._geomSubset = *geomSubset;
     }
 
-    renderItemData._indexBuffer.reset(
-        new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32));
+    if (_delegate) {
+        renderItemData._indexBuffer = _delegate->GetVP2BufferPool().AcquireIndexBuffer(
+            MHWRender::MGeometry::kUnsignedInt32);
+    } else {
+        renderItemData._indexBuffer.reset(
+            new MHWRender::MIndexBuffer(MHWRender::MGeometry::kUnsignedInt32));
+    }
 
     return renderItemData;
 }
@@ -101,6 +101,10 @@ public:
         //! Whether or not the render item is using GPU instanced draw.
         bool _usingInstancedDraw { false };
 
+        //! Generation of the Rprim primvar buffers last bound to the render item. The buffers
+        //! of removed primvars are recycled once all render items bound a later generation.
+        size_t _primvarGeneration { 0 };
+
         //! Dirty bits to control data update of draw item
         HdDirtyBits _dirtyBits { HdChangeTracker::AllDirty };
 
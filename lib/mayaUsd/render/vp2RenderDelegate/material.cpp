@@ -80,10 +80,14 @@
 
 #include <ghc/filesystem.hpp>
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 
+#include <algorithm>
+#include <deque>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -102,6 +106,25 @@ static bool _IsDisabledAsyncTextureLoading()
     return true;
 }
 
+static int _GetMaxTextureResolution()
+{
+    static const MString kOptionVarName(MayaUsdOptionVars->MaxTextureResolution.GetText());
+    if (MGlobal::optionVarExists(kOptionVarName)) {
+        return std::max(0, MGlobal::optionVarIntValue(kOptionVarName));
+    }
+    return 0;
+}
+
+static size_t _GetTextureMemoryBudget()
+{
+    static const MString kOptionVarName(MayaUsdOptionVars->TextureMemoryBudget.GetText());
+    if (MGlobal::optionVarExists(kOptionVarName)) {
+        const int budgetInMB = MGlobal::optionVarIntValue(kOptionVarName);
+        return budgetInMB > 0 ? static_cast<size_t>(budgetInMB) * 1024 * 1024 : 0;
+    }
+    return 0;
+}
+
 // Refresh viewport duration (in milliseconds)
 static const std::size_t kRefreshDuration { 1000 };
 
@@ -1591,8 +1614,50 @@ MHWRender::MSamplerStateDesc _GetSamplerStateDesc(const HdMaterialNode& node)
     return desc;
 }
 
-MHWRender::MTexture*
-_LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& uvScaleOffset)
+//! Name of the VP2 texture loaded from path. Resolution capped textures have their own name.
+std::string _GetTextureName(const std::string& path, int maxResolution)
+{
+    return maxResolution > 0 ? path + "?maxResolution=" + std::to_string(maxResolution) : path;
+}
+
+//! Names of the VP2 textures which were loaded below the full resolution of their image. A
+//! texture loaded with a resolution cap is not downscaled if its image already fits the cap.
+std::mutex                      _cappedTextureNamesMutex;
+std::unordered_set<std::string> _cappedTextureNames;
+
+void _SetTextureResolutionCapped(const std::string& textureName, bool isResolutionCapped)
+{
+    std::lock_guard<std::mutex> lock(_cappedTextureNamesMutex);
+    if (isResolutionCapped) {
+        _cappedTextureNames.insert(textureName);
+    } else {
+        _cappedTextureNames.erase(textureName);
+    }
+}
+
+bool _IsTextureResolutionCapped(const std::string& textureName)
+{
+    std::lock_guard<std::mutex> lock(_cappedTextureNamesMutex);
+    return _cappedTextureNames.count(textureName) > 0;
+}
+
+//! GPU memory used by the texture, in bytes.
+size_t _GetTextureMemoryUsage(MHWRender::MTexture* texture)
+{
+    if (!texture) {
+        return 0;
+    }
+    MHWRender::MTextureDescription desc;
+    texture->textureDescription(desc);
+    return static_cast<size_t>(desc.fBytesPerSlice) * std::max(1u, desc.fArraySlices);
+}
+
+MHWRender::MTexture* _LoadUdimTexture(
+    const std::string& path,
+    int                maxResolution,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset,
+    bool&              isResolutionCapped)
 {
     /*
         For this method to work path needs to be an absolute file path, not an asset path.
@@ -1623,8 +1688,11 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
         return nullptr;
     }
 
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
+    // used for caching, using the string with <UDIM> in it is fine
+    const std::string    textureName = _GetTextureName(path, maxResolution);
+    MHWRender::MTexture* texture = textureMgr->findTexture(textureName.c_str());
     if (texture) {
+        isResolutionCapped = _IsTextureResolutionCapped(textureName);
         return texture;
     }
 
@@ -1665,10 +1733,22 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
                 "UDIM texture %s creates a tiled texture larger than the maximum texture size. Some"
                 "resolution will be lost.",
                 path.c_str());
+
+        // Cap the resolution of each tile by capping the size of the tiled texture
+        if (maxResolution > 0) {
+            int numTilesU = 1;
+            int numTilesV = 1;
+            for (const auto& tile : tiles) {
+                numTilesU = std::max(numTilesU, std::get<0>(tile) % 10 + 1);
+                numTilesV = std::max(numTilesV, std::get<0>(tile) / 10 + 1);
+            }
+            const unsigned int resolution = static_cast<unsigned int>(maxResolution);
+            maxWidth = std::min(maxWidth, resolution * numTilesU);
+            maxHeight = std::min(maxHeight, resolution * numTilesV);
+            isResolutionCapped = tileWidth > resolution || tileHeight > resolution;
+        }
     }
 
-    MString textureName(
-        path.c_str()); // used for caching, using the string with <UDIM> in it is fine
     MStringArray tilePaths;
     MFloatArray  tilePositions;
     for (auto& tile : tiles) {
@@ -1710,6 +1790,9 @@ _LoadUdimTexture(const std::string& path, bool& isColorSpaceSRGB, MFloatArray& u
         TF_WARN("Failed to load <UDIM> texture tile %s", failedTilePaths[i].asChar());
     }
 
+    if (texture) {
+        _SetTextureResolutionCapped(textureName, isResolutionCapped);
+    }
     return texture;
 }
 
@@ -1739,45 +1822,78 @@ MHWRender::MTexture* _GenerateFallbackTexture(
     return textureMgr->acquireTexture(path.c_str(), desc, texels.data());
 }
 
-//! Load texture from the specified path
-MHWRender::MTexture* _LoadTexture(
-    const std::string& path,
-    bool               hasFallbackColor,
-    const GfVec4f&     fallbackColor,
-    bool&              isColorSpaceSRGB,
-    MFloatArray&       uvScaleOffset)
+//! Texture data decoded from an image file, ready to be uploaded with MTextureManager.
+struct _DecodedTexture
 {
-    MProfilingScope profilingScope(
-        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
+    enum class Status
+    {
+        kFailed,   //!< The image could not be decoded and has no fallback color
+        kFallback, //!< The image could not be decoded, the fallback color should be used
+        kUdim,     //!< UDIM textures are loaded by MTextureManager on main thread
+        kDecoded   //!< _desc and _texels hold the image, converted to a VP2 format
+    };
 
-    // If it is a UDIM texture we need to modify the path before calling OpenForReading
-    if (HdStIsSupportedUdimTexture(path))
-        return _LoadUdimTexture(path, isColorSpaceSRGB, uvScaleOffset);
+    Status                         _status { Status::kFailed };
+    MHWRender::MTextureDescription _desc;
+    std::vector<unsigned char>     _texels;
+    int                            _maxResolution { 0 }; //!< Resolution cap, 0 for no cap
+    bool                           _isColorSpaceSRGB { false };
+    bool                           _isResolutionCapped { false };
+};
 
-    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
-    MHWRender::MTextureManager* const textureMgr
-        = renderer ? renderer->getTextureManager() : nullptr;
-    if (!TF_VERIFY(textureMgr)) {
-        return nullptr;
-    }
+/*! \brief  Decode the image at the specified path and convert it to a format supported by VP2.
 
-    MHWRender::MTexture* texture = textureMgr->findTexture(path.c_str());
-    if (texture) {
-        return texture;
+    When maxResolution is positive, the image is read from the first mip level fitting in
+    maxResolution, and downsampled while reading if it still doesn't fit.
+
+    No VP2 API is called, so this function can run on worker threads.
+*/
+_DecodedTexture _DecodeTexture(const std::string& path, bool hasFallbackColor, int maxResolution)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "DecodeTexture",
+        path.c_str());
+
+    _DecodedTexture decoded;
+    decoded._maxResolution = maxResolution;
+
+    // UDIM tiles are read by MTextureManager::acquireTiledTexture
+    if (HdStIsSupportedUdimTexture(path)) {
+        decoded._status = _DecodedTexture::Status::kUdim;
+        return decoded;
     }
 
     HioImageSharedPtr image = HioImage::OpenForReading(path);
     if (!TF_VERIFY(image, "Unable to create an image from %s", path.c_str())) {
-        if (!hasFallbackColor) {
-            return nullptr;
+        // A 1x1 texture of the fallback color is created, if it was specified
+        if (hasFallbackColor) {
+            decoded._status = _DecodedTexture::Status::kFallback;
         }
-        // Create a 1x1 texture of the fallback color, if it was specified:
-        return _GenerateFallbackTexture(textureMgr, path, fallbackColor);
+        return decoded;
     }
 
     // This image is used for loading pixel data from usdz only and should
     // not trigger any OpenGL call. VP2RenderDelegate will transfer the
     // texels to GPU memory with VP2 API which is 3D API agnostic.
+    auto exceedsMaxResolution = [maxResolution](const HioImageSharedPtr& img) {
+        return maxResolution > 0 && std::max(img->GetWidth(), img->GetHeight()) > maxResolution;
+    };
+
+    if (exceedsMaxResolution(image)) {
+        decoded._isResolutionCapped = true;
+
+        const int numMipLevels = image->GetNumMipLevels();
+        for (int mip = 1; mip < numMipLevels && exceedsMaxResolution(image); ++mip) {
+            HioImageSharedPtr mipImage = HioImage::OpenForReading(path, 0, mip);
+            if (!mipImage) {
+                break;
+            }
+            image = mipImage;
+        }
+    }
+
     HioImage::StorageSpec spec;
     spec.width = image->GetWidth();
     spec.height = image->GetHeight();
@@ -1785,6 +1901,13 @@ MHWRender::MTexture* _LoadTexture(
     spec.format = image->GetFormat();
     spec.flipped = false;
 
+    // No mip level fits, let HioImage resize while reading
+    if (exceedsMaxResolution(image)) {
+        const double scale = static_cast<double>(maxResolution) / std::max(spec.width, spec.height);
+        spec.width = std::max(1, static_cast<int>(spec.width * scale));
+        spec.height = std::max(1, static_cast<int>(spec.height * scale));
+    }
+
     const int bpp = image->GetBytesPerPixel();
     const int bytesPerRow = spec.width * bpp;
     const int bytesPerSlice = bytesPerRow * spec.height;
@@ -1793,10 +1916,10 @@ MHWRender::MTexture* _LoadTexture(
     spec.data = storage.data();
 
     if (!image->Read(spec)) {
-        return nullptr;
+        return decoded;
     }
 
-    MHWRender::MTextureDescription desc;
+    MHWRender::MTextureDescription& desc = decoded._desc;
     desc.setToDefault2DTexture();
     desc.fWidth = spec.width;
     desc.fHeight = spec.height;
@@ -1826,7 +1949,7 @@ MHWRender::MTexture* _LoadTexture(
             *texels32++ = pixel;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+        decoded._texels = std::move(texels);
     } break;
     case HioFormatFloat16: {
         // We want white instead or red when expanding to RGB, so convert to kR16G16B16A16_FLOAT
@@ -1852,7 +1975,7 @@ MHWRender::MTexture* _LoadTexture(
             *texels16++ = alphaBits;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+        decoded._texels = std::move(texels);
     } break;
     case HioFormatUNorm8: {
         // We want white instead or red when expanding to RGB, so convert to kR8G8B8A8_UNORM
@@ -1875,8 +1998,8 @@ MHWRender::MTexture* _LoadTexture(
             *texels8++ = 0xFF;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded._texels = std::move(texels);
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
     } break;
 
     // Dual channel (quite rare, but seen with mono + alpha files)
@@ -1901,7 +2024,7 @@ MHWRender::MTexture* _LoadTexture(
             *texels32++ = *storage32++;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+        decoded._texels = std::move(texels);
     } break;
     case HioFormatFloat16Vec2: {
         // R16G16 is not supported by VP2. Converted to R16G16B16A16.
@@ -1924,7 +2047,7 @@ MHWRender::MTexture* _LoadTexture(
             *texels16++ = *storage16++;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+        decoded._texels = std::move(texels);
         break;
     }
     case HioFormatUNorm8Vec2:
@@ -1949,15 +2072,15 @@ MHWRender::MTexture* _LoadTexture(
             *texels8++ = *storage8++;
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded._texels = std::move(texels);
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 3-Channel
     case HioFormatFloat32Vec3:
         desc.fFormat = MHWRender::kR32G32B32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        decoded._texels = std::move(storage);
         break;
     case HioFormatFloat16Vec3: {
         // R16G16B16 is not supported by VP2. Converted to R16G16B16A16.
@@ -1988,12 +2111,12 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
+        decoded._texels = std::move(texels);
         break;
     }
     case HioFormatFloat16Vec4:
         desc.fFormat = MHWRender::kR16G16B16A16_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        decoded._texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec3:
     case HioFormatUNorm8Vec3srgb: {
@@ -2016,31 +2139,123 @@ MHWRender::MTexture* _LoadTexture(
             }
         }
 
-        texture = textureMgr->acquireTexture(path.c_str(), desc, texels.data());
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded._texels = std::move(texels);
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
         break;
     }
 
     // 4-Channel
     case HioFormatFloat32Vec4:
         desc.fFormat = MHWRender::kR32G32B32A32_FLOAT;
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        decoded._texels = std::move(storage);
         break;
     case HioFormatUNorm8Vec4:
     case HioFormatUNorm8Vec4srgb:
         desc.fFormat = MHWRender::kR8G8B8A8_UNORM;
-        isColorSpaceSRGB = image->IsColorSpaceSRGB();
-        texture = textureMgr->acquireTexture(path.c_str(), desc, spec.data);
+        decoded._isColorSpaceSRGB = image->IsColorSpaceSRGB();
+        decoded._texels = std::move(storage);
         break;
     default:
         TF_WARN(
             "VP2 renderer delegate: unsupported pixel format (%d) in texture file %s.",
             (int)specFormat,
             path.c_str());
-        break;
+        return decoded;
     }
 
-    return texture;
+    decoded._status = _DecodedTexture::Status::kDecoded;
+    return decoded;
+}
+
+/*! \brief  Upload a decoded texture to VP2.
+
+    Must be called on main thread.
+*/
+MHWRender::MTexture* _UploadTexture(
+    const std::string& path,
+    const GfVec4f&     fallbackColor,
+    _DecodedTexture&   decoded,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset,
+    bool&              isResolutionCapped)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory,
+        MProfiler::kColorD_L2,
+        "UploadTexture",
+        path.c_str());
+
+    if (decoded._status == _DecodedTexture::Status::kUdim) {
+        return _LoadUdimTexture(
+            path, decoded._maxResolution, isColorSpaceSRGB, uvScaleOffset, isResolutionCapped);
+    }
+
+    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+    MHWRender::MTextureManager* const textureMgr
+        = renderer ? renderer->getTextureManager() : nullptr;
+    if (!TF_VERIFY(textureMgr)) {
+        return nullptr;
+    }
+
+    const std::string textureName = _GetTextureName(path, decoded._maxResolution);
+    isResolutionCapped = decoded._isResolutionCapped;
+
+    MHWRender::MTexture* texture = textureMgr->findTexture(textureName.c_str());
+    if (texture) {
+        return texture;
+    }
+
+    switch (decoded._status) {
+    case _DecodedTexture::Status::kDecoded:
+        isColorSpaceSRGB = decoded._isColorSpaceSRGB;
+        texture = textureMgr->acquireTexture(
+            textureName.c_str(), decoded._desc, decoded._texels.data());
+        if (texture) {
+            _SetTextureResolutionCapped(textureName, isResolutionCapped);
+        }
+        return texture;
+    case _DecodedTexture::Status::kFallback:
+        return _GenerateFallbackTexture(textureMgr, path, fallbackColor);
+    default: return nullptr;
+    }
+}
+
+//! Load texture from the specified path, capped to maxResolution if positive
+MHWRender::MTexture* _LoadTexture(
+    const std::string& path,
+    bool               hasFallbackColor,
+    const GfVec4f&     fallbackColor,
+    int                maxResolution,
+    bool&              isColorSpaceSRGB,
+    MFloatArray&       uvScaleOffset,
+    bool&              isResolutionCapped)
+{
+    MProfilingScope profilingScope(
+        HdVP2RenderDelegate::sProfilerCategory, MProfiler::kColorD_L2, "LoadTexture", path.c_str());
+
+    // If it is a UDIM texture we need to modify the path before calling OpenForReading
+    if (HdStIsSupportedUdimTexture(path)) {
+        return _LoadUdimTexture(
+            path, maxResolution, isColorSpaceSRGB, uvScaleOffset, isResolutionCapped);
+    }
+
+    MHWRender::MRenderer* const       renderer = MHWRender::MRenderer::theRenderer();
+    MHWRender::MTextureManager* const textureMgr
+        = renderer ? renderer->getTextureManager() : nullptr;
+    if (!TF_VERIFY(textureMgr)) {
+        return nullptr;
+    }
+
+    const std::string    textureName = _GetTextureName(path, maxResolution);
+    MHWRender::MTexture* texture = textureMgr->findTexture(textureName.c_str());
+    if (texture) {
+        isResolutionCapped = _IsTextureResolutionCapped(textureName);
+        return texture;
+    }
+
+    _DecodedTexture decoded = _DecodeTexture(path, hasFallbackColor, maxResolution);
+    return _UploadTexture(
+        path, fallbackColor, decoded, isColorSpaceSRGB, uvScaleOffset, isResolutionCapped);
 }
 
 TfToken MayaDescriptorToToken(const MVertexBufferDescriptor& descriptor)
@@ -2075,6 +2290,16 @@ struct MStringHash
     }
 };
 
+//! Number of worker threads decoding textures: half of the hardware threads, between 1 and 8.
+int _GetTextureDecodeConcurrency()
+{
+    const int hardwareConcurrency = static_cast<int>(std::thread::hardware_concurrency());
+    return std::max(1, std::min(hardwareConcurrency / 2, 8));
+}
+
+//! Time budget of an idle task uploading decoded textures (in milliseconds)
+constexpr double kUploadBudgetPerIdle { 16.0 };
+
 } // anonymous namespace
 
 class HdVP2Material::TextureLoadingTask
@@ -2085,11 +2310,13 @@ public:
         HdSceneDelegate*   sceneDelegate,
         const std::string& path,
         bool               hasFallbackColor,
-        const GfVec4f&     fallbackColor)
+        const GfVec4f&     fallbackColor,
+        int                maxResolution)
         : _parent(parent)
         , _sceneDelegate(sceneDelegate)
         , _path(path)
         , _fallbackColor(fallbackColor)
+        , _maxResolution(maxResolution)
         , _hasFallbackColor(hasFallbackColor)
     {
     }
@@ -2115,46 +2342,209 @@ public:
         return _fallbackTextureInfo;
     }
 
-    bool EnqueueLoadOnIdle()
+    /*! \brief  Push the texture decoding to the worker threads.
+
+        Once decoded, the texture is uploaded to VP2 on idle. The pipeline holds its own
+        reference to the task until it is done with it.
+    */
+    bool EnqueueLoad()
     {
         if (_started.exchange(true)) {
             return false;
         }
-        // Push the texture loading on idle
-        auto ret = MGlobal::executeTaskOnIdle(
-            [](void* data) {
-                auto* task = static_cast<HdVP2Material::TextureLoadingTask*>(data);
-                task->_Load();
-                // Once it is done, free the memory.
-                delete task;
-            },
-            this);
-        return ret == MStatus::kSuccess;
+
+        ++_refCount;
+        _Pipeline& pipeline = _GetPipeline();
+        ++pipeline._decodeQueueDepth;
+        pipeline._arena.enqueue([this]() { _Decode(); });
+        return true;
+    }
+
+    //! Tell the task its material is no longer valid, the task is not uploaded anymore.
+    void Terminate() { _terminated = true; }
+
+    /*! \brief  Release a reference to the task, held either by the material or by the
+                pipeline, and delete the task once both are released.
+    */
+    static void Release(TextureLoadingTask* task)
+    {
+        if (--task->_refCount == 0) {
+            delete task;
+        }
     }
 
-    bool Terminate()
+    static HdVP2TextureDecodeStats GetDecodeStats()
     {
-        _terminated = true;
-        // Return the started state to caller, the caller will delete this object
-        // if this task has not started yet.
-        // We will not be able to delete this object within its method.
-        return !_started.load();
+        _Pipeline& pipeline = _GetPipeline();
+
+        std::lock_guard<std::mutex> lock(pipeline._mutex);
+        HdVP2TextureDecodeStats     stats = pipeline._stats;
+        stats._decodeQueueDepth = pipeline._decodeQueueDepth.load();
+        stats._pendingUploadCount = pipeline._uploadQueue.size();
+        return stats;
+    }
+
+    static void OnMayaExit()
+    {
+        _Pipeline& pipeline = _GetPipeline();
+        pipeline._exiting = true;
+
+        // Tasks still being decoded release themselves when done. Release the decoded
+        // tasks since no upload will happen anymore, the tasks still referenced by their
+        // material are deleted by HdVP2Material::ClearPendingTasks().
+        std::lock_guard<std::mutex> lock(pipeline._mutex);
+        for (TextureLoadingTask* task : pipeline._uploadQueue) {
+            Release(task);
+        }
+        pipeline._uploadQueue.clear();
     }
 
 private:
-    void _Load()
+    //! Worker threads decoding textures, and decoded textures waiting for upload.
+    struct _Pipeline
+    {
+        _Pipeline()
+            : _arena(_GetTextureDecodeConcurrency(), 0)
+        {
+        }
+
+        tbb::task_arena    _arena;                //!< Bounded pool of decoding threads
+        std::atomic_size_t _decodeQueueDepth { 0 }; //!< Textures enqueued but not decoded
+        std::atomic_bool   _exiting { false };      //!< Maya is exiting, skip all work
+
+        std::mutex                      _mutex;       //!< Protects the members below
+        std::deque<TextureLoadingTask*> _uploadQueue; //!< Decoded tasks, in decoding order
+        bool                            _uploadScheduled { false }; //!< Idle task pending
+        HdVP2TextureDecodeStats         _stats;
+    };
+
+    static _Pipeline& _GetPipeline()
+    {
+        // Intentionally leaked, worker threads may still reference it while Maya exits.
+        static _Pipeline* sPipeline = new _Pipeline;
+        return *sPipeline;
+    }
+
+    //! Decode the texture on a worker thread, then queue it for upload.
+    void _Decode()
+    {
+        _Pipeline& pipeline = _GetPipeline();
+        --pipeline._decodeQueueDepth;
+
+        if (_terminated || pipeline._exiting) {
+            Release(this);
+            return;
+        }
+
+        const auto startTime = std::chrono::steady_clock::now();
+        _decoded = _DecodeTexture(_path, _hasFallbackColor, _maxResolution);
+        const std::chrono::duration<double> decodeTime
+            = std::chrono::steady_clock::now() - startTime;
+
+        bool scheduleUpload = false;
+        {
+            std::lock_guard<std::mutex> lock(pipeline._mutex);
+            ++pipeline._stats._decodedCount;
+            pipeline._stats._decodedBytes += _decoded._texels.size();
+            pipeline._stats._decodeSeconds += decodeTime.count();
+
+            if (pipeline._exiting) {
+                Release(this);
+                return;
+            }
+
+            pipeline._uploadQueue.push_back(this);
+            scheduleUpload = !pipeline._uploadScheduled;
+            pipeline._uploadScheduled = true;
+        }
+
+        // A single idle task drains the upload queue
+        if (scheduleUpload) {
+            MGlobal::executeTaskOnIdle(_UploadDecodedTasks);
+        }
+    }
+
+    /*! \brief  Upload decoded textures on idle, within a time budget.
+
+        At least one texture is uploaded per call, the remaining ones are uploaded by
+        the next idle task so interaction stays responsive while textures stream in.
+    */
+    static void _UploadDecodedTasks(void* /* unusedData */)
+    {
+        _Pipeline& pipeline = _GetPipeline();
+        if (pipeline._exiting) {
+            return;
+        }
+
+        MProfilingScope profilingScope(
+            HdVP2RenderDelegate::sProfilerCategory,
+            MProfiler::kColorD_L2,
+            "UploadDecodedTextures");
+
+        const auto startTime = std::chrono::steady_clock::now();
+        auto       elapsedMs = [&startTime]() {
+            return std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - startTime)
+                .count();
+        };
+
+        size_t uploadCount = 0;
+        bool   reschedule = false;
+        for (;;) {
+            TextureLoadingTask* task = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(pipeline._mutex);
+                if (pipeline._uploadQueue.empty()) {
+                    pipeline._uploadScheduled = false;
+                    break;
+                }
+                if (uploadCount > 0 && elapsedMs() >= kUploadBudgetPerIdle) {
+                    // _uploadScheduled stays set, the next idle task is ours
+                    reschedule = true;
+                    break;
+                }
+                task = pipeline._uploadQueue.front();
+                pipeline._uploadQueue.pop_front();
+            }
+
+            task->_Upload();
+            Release(task);
+            ++uploadCount;
+        }
+
+        if (reschedule) {
+            MGlobal::executeTaskOnIdle(_UploadDecodedTasks);
+        }
+
+        if (TfDebug::IsEnabled(HDVP2_DEBUG_MATERIAL)) {
+            const HdVP2TextureDecodeStats stats = GetDecodeStats();
+            TfDebug::Helper().Msg(
+                "Uploaded %zu textures in %.3f ms, %zu waiting for decode, %zu waiting for "
+                "upload, decode throughput %.1f MB/s\n",
+                uploadCount,
+                elapsedMs(),
+                stats._decodeQueueDepth,
+                stats._pendingUploadCount,
+                stats.DecodeThroughput());
+        }
+    }
+
+    //! Upload the decoded texture to VP2 and notify the material, on main thread.
+    void _Upload()
     {
         if (_terminated) {
             return;
         }
         bool        isSRGB = false;
+        bool        isResolutionCapped = false;
         MFloatArray uvScaleOffset;
-        auto*       texture
-            = _LoadTexture(_path, _hasFallbackColor, _fallbackColor, isSRGB, uvScaleOffset);
+        auto*       texture = _UploadTexture(
+            _path, _fallbackColor, _decoded, isSRGB, uvScaleOffset, isResolutionCapped);
         if (_terminated) {
             return;
         }
-        _parent->_UpdateLoadedTexture(_sceneDelegate, _path, texture, isSRGB, uvScaleOffset);
+        _parent->_UpdateLoadedTexture(
+            _sceneDelegate, _path, texture, isSRGB, uvScaleOffset, isResolutionCapped);
     }
 
     HdVP2TextureInfo  _fallbackTextureInfo;
@@ -2162,8 +2552,11 @@ private:
     HdSceneDelegate*  _sceneDelegate;
     const std::string _path;
     const GfVec4f     _fallbackColor;
+    const int         _maxResolution;
+    _DecodedTexture   _decoded;
     std::atomic_bool  _started { false };
-    bool              _terminated { false };
+    std::atomic_bool  _terminated { false };
+    std::atomic_int   _refCount { 1 }; //!< References held by the material and the pipeline
     bool              _hasFallbackColor;
 };
 
@@ -2171,6 +2564,7 @@ std::mutex                            HdVP2Material::_refreshMutex;
 std::chrono::steady_clock::time_point HdVP2Material::_startTime;
 std::atomic_size_t                    HdVP2Material::_runningTasksCounter;
 HdVP2GlobalTextureMap                 HdVP2Material::_globalTextureMap;
+std::list<HdVP2Material*>             HdVP2Material::_fullResolutionMaterials;
 
 /*! \brief  Releases the reference to the texture owned by a smart pointer.
  */
@@ -2198,6 +2592,8 @@ HdVP2Material::~HdVP2Material()
     // Tell pending tasks or running tasks (if any) to terminate
     ClearPendingTasks();
 
+    _fullResolutionMaterials.remove(this);
+
     if (!_IsDisabledAsyncTextureLoading() && !_localTextureMap.empty()) {
         _TransientTexturePreserver::GetInstance().PreserveTextures(_localTextureMap);
     }
@@ -3729,12 +4125,21 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         hasFallbackColor = true;
     }
 
+    const int maxResolution = _GetMaxTextureResolution();
+
     if (_IsDisabledAsyncTextureLoading()) {
         bool        isSRGB = false;
+        bool        isResolutionCapped = false;
         MFloatArray uvScaleOffset;
 
-        MHWRender::MTexture* texture
-            = _LoadTexture(path, hasFallbackColor, fallbackColor, isSRGB, uvScaleOffset);
+        MHWRender::MTexture* texture = _LoadTexture(
+            path,
+            hasFallbackColor,
+            fallbackColor,
+            maxResolution,
+            isSRGB,
+            uvScaleOffset,
+            isResolutionCapped);
 
         HdVP2TextureInfoSharedPtr info = std::make_shared<HdVP2TextureInfo>();
         // path should never already be in _localTextureMap because if it was
@@ -3745,6 +4150,8 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
         _globalTextureMap.emplace(path, info);
         info->_texture.reset(texture);
         info->_isColorSpaceSRGB = isSRGB;
+        info->_isResolutionCapped = isResolutionCapped;
+        info->_memoryUsage = _GetTextureMemoryUsage(texture);
         if (uvScaleOffset.length() > 0) {
             TF_VERIFY(uvScaleOffset.length() == 4);
             info->_stScale.Set(
@@ -3753,18 +4160,35 @@ const HdVP2TextureInfo& HdVP2Material::_AcquireTexture(
                 uvScaleOffset[2], uvScaleOffset[3]); // The next two elements are the offset
         }
 
+        // Other materials may be downgraded, so the budget is enforced once the Sync is done
+        if (texture && _GetTextureMemoryBudget() > 0) {
+            _renderDelegate->GetVP2ResourceRegistry().EnqueueCommit(
+                [this]() { _EvictTexturesToBudget(this); });
+        }
+
         return *info;
     }
 
-    auto* task = new TextureLoadingTask(this, sceneDelegate, path, hasFallbackColor, fallbackColor);
+    std::lock_guard<std::mutex> lock(_textureLoadingTasksMutex);
+
+    // The texture is already loading
+    const auto taskIt = _textureLoadingTasks.find(path);
+    if (taskIt != _textureLoadingTasks.end()) {
+        return taskIt->second->GetFallbackTextureInfo();
+    }
+
+    auto* task = new TextureLoadingTask(
+        this, sceneDelegate, path, hasFallbackColor, fallbackColor, maxResolution);
     _textureLoadingTasks.emplace(path, task);
     return task->GetFallbackTextureInfo();
 }
 
 void HdVP2Material::EnqueueLoadTextures()
 {
+    std::lock_guard<std::mutex> lock(_textureLoadingTasksMutex);
+
     for (const auto& task : _textureLoadingTasks) {
-        if (task.second->EnqueueLoadOnIdle()) {
+        if (task.second->EnqueueLoad()) {
             ++_runningTasksCounter;
         }
     }
@@ -3772,13 +4196,14 @@ void HdVP2Material::EnqueueLoadTextures()
 
 void HdVP2Material::ClearPendingTasks()
 {
+    std::lock_guard<std::mutex> lock(_textureLoadingTasksMutex);
+
     // Inform tasks that have not started or finished that this material object
-    // is no longer valid
+    // is no longer valid, and release the reference of the material. Started tasks
+    // are deleted once the pipeline releases them too.
     for (auto& task : _textureLoadingTasks) {
-        if (task.second->Terminate()) {
-            // Delete the pointer: we can only do that outside of the object scope
-            delete task.second;
-        }
+        task.second->Terminate();
+        TextureLoadingTask::Release(task.second);
     }
 
     // Remove the reference of all the tasks
@@ -3793,7 +4218,8 @@ void HdVP2Material::_UpdateLoadedTexture(
     const std::string&   path,
     MHWRender::MTexture* texture,
     bool                 isColorSpaceSRGB,
-    const MFloatArray&   uvScaleOffset)
+    const MFloatArray&   uvScaleOffset,
+    bool                 isResolutionCapped)
 {
     // Decrease the counter if texture finished loading.
     // Please notice that we do not do the same thing for terminated tasks,
@@ -3804,24 +4230,39 @@ void HdVP2Material::_UpdateLoadedTexture(
         --_runningTasksCounter;
     }
 
-    // Pop the task object from the container, since this method is
-    // called directly from the task object method `loadOnIdle()`,
-    // we do not handle the deletion here, we will let the
-    // function on idle to delete the task object.
-    _textureLoadingTasks.erase(path);
+    // Pop the task object from the container. Since this method is called
+    // directly from the task object method `_Upload()`, the pipeline still
+    // holds a reference to the task and deletes it once the upload is done.
+    {
+        std::lock_guard<std::mutex> lock(_textureLoadingTasksMutex);
+        const auto taskIt = _textureLoadingTasks.find(path);
+        if (taskIt != _textureLoadingTasks.end()) {
+            TextureLoadingTask::Release(taskIt->second);
+            _textureLoadingTasks.erase(taskIt);
+        }
+    }
 
-    // Check the cache again. If the texture is not in the cache
-    // the add it.
-    if (_globalTextureMap.find(path) == _globalTextureMap.end()) {
+    // A texture already used by this material was reloaded at a different resolution
+    const auto localIt = _localTextureMap.find(path);
+    const bool isReload = localIt != _localTextureMap.end() && localIt->second;
+
+    // Check the cache again. If the texture is not in the cache, or if it is
+    // cached at a different resolution, then add it.
+    const auto                globalIt = _globalTextureMap.find(path);
+    HdVP2TextureInfoSharedPtr cacheEntry
+        = globalIt != _globalTextureMap.end() ? globalIt->second.lock() : nullptr;
+    if (cacheEntry && (!texture || cacheEntry->_isResolutionCapped == isResolutionCapped)) {
+        if (isReload) {
+            _localTextureMap[path] = cacheEntry;
+        }
+    } else if (texture || !isReload) {
         HdVP2TextureInfoSharedPtr info = std::make_shared<HdVP2TextureInfo>();
-        // path should never already be in _localTextureMap because if it was
-        // we'd have found it in _globalTextureMap
-        _localTextureMap.emplace(path, info);
-        // path should never already be in _globalTextureMap because if it was present
-        // and nullptr then we erased it.
-        _globalTextureMap.emplace(path, info);
+        _localTextureMap[path] = info;
+        _globalTextureMap[path] = info;
         info->_texture.reset(texture);
         info->_isColorSpaceSRGB = isColorSpaceSRGB;
+        info->_isResolutionCapped = isResolutionCapped;
+        info->_memoryUsage = _GetTextureMemoryUsage(texture);
         if (uvScaleOffset.length() > 0) {
             TF_VERIFY(uvScaleOffset.length() == 4);
             info->_stScale.Set(
@@ -3831,6 +4272,25 @@ void HdVP2Material::_UpdateLoadedTexture(
         }
     }
 
+    if (isReload) {
+        if (!_localTextureMap[path]->_isResolutionCapped) {
+            _upgradedTextures.insert(path);
+
+            // Most recently upgraded materials are the last ones to be downgraded
+            _fullResolutionMaterials.remove(this);
+            _fullResolutionMaterials.push_back(this);
+
+            _EvictTexturesToBudget(this);
+        } else {
+            _upgradedTextures.erase(path);
+            if (_upgradedTextures.empty()) {
+                _fullResolutionMaterials.remove(this);
+            }
+        }
+    } else if (texture) {
+        _EvictTexturesToBudget(this);
+    }
+
     // Mark sprim dirty
     sceneDelegate->GetRenderIndex().GetChangeTracker().MarkSprimDirty(
         GetId(), HdMaterial::DirtyResource);
@@ -3838,6 +4298,188 @@ void HdVP2Material::_UpdateLoadedTexture(
     _ScheduleRefresh();
 }
 
+/*! \brief  Load the resolution capped textures of this material at full resolution.
+
+    Called from Rprim Sync, possibly on worker threads, when the Rprim is visible and selected.
+    The local textures are only modified on main thread, so the reload is started by a commit
+    task, once all Rprims are synced.
+*/
+void HdVP2Material::RequestFullResolutionTextures(
+    HdSceneDelegate* sceneDelegate,
+    const SdfPath&   rprimId)
+{
+    {
+        std::lock_guard<std::mutex> lock(_fullResolutionMutex);
+        _fullResolutionRprims.insert(rprimId);
+        _fullResolutionSceneDelegate = sceneDelegate;
+        if (_fullResolutionRequested) {
+            return;
+        }
+        _fullResolutionRequested = true;
+    }
+
+    _renderDelegate->GetVP2ResourceRegistry().EnqueueCommit(
+        [this]() { _ReloadCappedTextures(); });
+}
+
+/*! \brief  Reload the resolution capped textures at full resolution, on main thread.
+ */
+void HdVP2Material::_ReloadCappedTextures()
+{
+    HdSceneDelegate* sceneDelegate = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_fullResolutionMutex);
+        _fullResolutionRequested = false;
+        if (_fullResolutionRprims.empty()) {
+            return;
+        }
+        sceneDelegate = _fullResolutionSceneDelegate;
+    }
+
+    // Textures reloaded synchronously are replaced in the local texture map
+    std::vector<std::string> cappedPaths;
+    for (const auto& entry : _localTextureMap) {
+        if (entry.second && entry.second->_isResolutionCapped) {
+            cappedPaths.push_back(entry.first);
+        }
+    }
+    for (const std::string& path : cappedPaths) {
+        _EnqueueTextureReload(sceneDelegate, path, 0);
+    }
+}
+
+/*! \brief  The Rprim no longer needs full resolution textures.
+
+    Upgraded textures are kept until the texture memory budget is exceeded.
+*/
+void HdVP2Material::ReleaseFullResolutionTextures(const SdfPath& rprimId)
+{
+    std::lock_guard<std::mutex> lock(_fullResolutionMutex);
+    _fullResolutionRprims.erase(rprimId);
+}
+
+/*! \brief  Reload a texture used by this material at the specified resolution cap.
+
+    The current texture stays in use until the reloaded one is uploaded.
+*/
+void HdVP2Material::_EnqueueTextureReload(
+    HdSceneDelegate*   sceneDelegate,
+    const std::string& path,
+    int                maxResolution)
+{
+    if (_IsDisabledAsyncTextureLoading()) {
+        bool        isSRGB = false;
+        bool        isResolutionCapped = false;
+        MFloatArray uvScaleOffset;
+
+        MHWRender::MTexture* texture = _LoadTexture(
+            path, false, GfVec4f(0.0f), maxResolution, isSRGB, uvScaleOffset, isResolutionCapped);
+        // Balance the decrement of _UpdateLoadedTexture, which expects a running task
+        ++_runningTasksCounter;
+        _UpdateLoadedTexture(
+            sceneDelegate, path, texture, isSRGB, uvScaleOffset, isResolutionCapped);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_textureLoadingTasksMutex);
+
+    // The texture is already loading
+    if (_textureLoadingTasks.find(path) != _textureLoadingTasks.end()) {
+        return;
+    }
+
+    auto* task
+        = new TextureLoadingTask(this, sceneDelegate, path, false, GfVec4f(0.0f), maxResolution);
+    _textureLoadingTasks.emplace(path, task);
+    if (task->EnqueueLoad()) {
+        ++_runningTasksCounter;
+    }
+}
+
+/*! \brief  Reload the full resolution textures of this material at the capped resolution.
+
+    The full resolution textures are removed from the global texture map so other materials
+    stop sharing them, and are released once the capped textures are uploaded.
+*/
+void HdVP2Material::_DowngradeTextures()
+{
+    HdSceneDelegate* sceneDelegate = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_fullResolutionMutex);
+        sceneDelegate = _fullResolutionSceneDelegate;
+    }
+
+    const int maxResolution = _GetMaxTextureResolution();
+    if (!sceneDelegate || maxResolution <= 0) {
+        return;
+    }
+
+    // Textures reloaded synchronously are removed from the upgraded textures
+    const std::set<std::string> upgradedTextures = _upgradedTextures;
+    for (const std::string& path : upgradedTextures) {
+        const auto localIt = _localTextureMap.find(path);
+        const auto globalIt = _globalTextureMap.find(path);
+        if (localIt != _localTextureMap.end() && globalIt != _globalTextureMap.end()
+            && globalIt->second.lock() == localIt->second) {
+            _globalTextureMap.erase(globalIt);
+        }
+        _EnqueueTextureReload(sceneDelegate, path, maxResolution);
+    }
+}
+
+/*! \brief  Downgrade full resolution textures until the texture memory fits the budget.
+
+    Called on main thread whenever a texture is loaded or upgraded. Materials no longer used
+    by selected Rprims are downgraded first, then the least recently upgraded ones. The
+    requester, which just loaded its textures, is kept.
+*/
+/*static*/
+void HdVP2Material::_EvictTexturesToBudget(HdVP2Material* requester)
+{
+    const size_t budget = _GetTextureMemoryBudget();
+    if (budget == 0) {
+        return;
+    }
+
+    size_t memoryUsage = GetTextureMemoryUsage();
+    if (memoryUsage <= budget) {
+        return;
+    }
+
+    for (const bool evictSelected : { false, true }) {
+        auto it = _fullResolutionMaterials.begin();
+        while (it != _fullResolutionMaterials.end() && memoryUsage > budget) {
+            HdVP2Material* material = *it;
+
+            bool isSelected = false;
+            {
+                std::lock_guard<std::mutex> lock(material->_fullResolutionMutex);
+                isSelected = !material->_fullResolutionRprims.empty();
+            }
+            if (material == requester || isSelected != evictSelected) {
+                ++it;
+                continue;
+            }
+
+            for (const std::string& path : material->_upgradedTextures) {
+                const auto localIt = material->_localTextureMap.find(path);
+                if (localIt != material->_localTextureMap.end() && localIt->second) {
+                    memoryUsage -= std::min(memoryUsage, localIt->second->_memoryUsage);
+                }
+            }
+
+            it = _fullResolutionMaterials.erase(it);
+            material->_DowngradeTextures();
+        }
+    }
+
+    TF_DEBUG(HDVP2_DEBUG_MATERIAL)
+        .Msg(
+            "Texture memory budget %zu MB, expected usage after downgrades %zu MB\n",
+            budget / (1024 * 1024),
+            memoryUsage / (1024 * 1024));
+}
+
 /*static*/
 void HdVP2Material::_ScheduleRefresh()
 {
@@ -3926,10 +4568,32 @@ void HdVP2Material::MaterialChanged(HdSceneDelegate* sceneDelegate)
     }
 }
 
+/*! \brief  Returns statistics of the asynchronous texture decoding and upload.
+ */
+HdVP2TextureDecodeStats HdVP2Material::GetTextureDecodeStats()
+{
+    return TextureLoadingTask::GetDecodeStats();
+}
+
+/*! \brief  Returns the GPU memory used by the textures of all materials, in bytes.
+ */
+size_t HdVP2Material::GetTextureMemoryUsage()
+{
+    size_t memoryUsage = 0;
+    for (const auto& entry : _globalTextureMap) {
+        if (HdVP2TextureInfoSharedPtr info = entry.second.lock()) {
+            memoryUsage += info->_memoryUsage;
+        }
+    }
+    return memoryUsage;
+}
+
 void HdVP2Material::OnMayaExit()
 {
+    TextureLoadingTask::OnMayaExit();
     _TransientTexturePreserver::GetInstance().OnMayaExit();
     _globalTextureMap.clear();
+    _fullResolutionMaterials.clear();
     HdVP2RenderDelegate::OnMayaExit();
 }
 
@@ -25,6 +25,7 @@
 #include <maya/MShaderManager.h>
 
 #include <chrono>
+#include <list>
 #include <mutex>
 #include <set>
 #include <unordered_map>
@@ -56,10 +57,12 @@ using HdVP2TextureUniquePtr = std::unique_ptr<MHWRender::MTexture, HdVP2TextureD
  */
 struct HdVP2TextureInfo
 {
-    HdVP2TextureUniquePtr _texture;                    //!< Unique pointer of the texture
-    GfVec2f               _stScale { 1.0f, 1.0f };     //!< UV scale for tiled textures
-    GfVec2f               _stOffset { 0.0f, 0.0f };    //!< UV offset for tiled textures
-    bool                  _isColorSpaceSRGB { false }; //!< Whether sRGB linearization is needed
+    HdVP2TextureUniquePtr _texture;                      //!< Unique pointer of the texture
+    GfVec2f               _stScale { 1.0f, 1.0f };       //!< UV scale for tiled textures
+    GfVec2f               _stOffset { 0.0f, 0.0f };      //!< UV offset for tiled textures
+    bool                  _isColorSpaceSRGB { false };   //!< Whether sRGB linearization is needed
+    bool                  _isResolutionCapped { false }; //!< Whether loaded below full resolution
+    size_t                _memoryUsage { 0 };            //!< GPU memory of the texture, in bytes
 };
 
 using HdVP2TextureInfoSharedPtr = std::shared_ptr<HdVP2TextureInfo>;
@@ -78,6 +81,26 @@ using HdVP2TextureInfoWeakPtr = std::weak_ptr<HdVP2TextureInfo>;
 using HdVP2LocalTextureMap = std::unordered_map<std::string, HdVP2TextureInfoSharedPtr>;
 using HdVP2GlobalTextureMap = std::unordered_map<std::string, HdVP2TextureInfoWeakPtr>;
 
+/*! \brief  Statistics of the asynchronous texture loading pipeline.
+    \struct HdVP2TextureDecodeStats
+
+    Images are decoded and converted on worker threads, then uploaded to VP2 on idle.
+*/
+struct HdVP2TextureDecodeStats
+{
+    size_t _decodeQueueDepth { 0 };  //!< Number of textures waiting to be decoded
+    size_t _pendingUploadCount { 0 }; //!< Number of decoded textures waiting to be uploaded
+    size_t _decodedCount { 0 };      //!< Number of textures decoded since startup
+    size_t _decodedBytes { 0 };      //!< Texel memory produced by the decoded textures
+    double _decodeSeconds { 0.0 };   //!< Cumulated decode time over all worker threads
+
+    //! Decoded texel memory per second of decode time, in MB/s.
+    double DecodeThroughput() const
+    {
+        return _decodeSeconds > 0.0 ? _decodedBytes / (1024.0 * 1024.0) / _decodeSeconds : 0.0;
+    }
+};
+
 /*! \brief  A VP2-specific implementation for a Hydra material prim.
     \class  HdVP2Material
 
@@ -106,6 +129,12 @@ public:
     void EnqueueLoadTextures();
     void ClearPendingTasks();
 
+    //! Load the resolution capped textures at full resolution for the specified Rprim.
+    void RequestFullResolutionTextures(HdSceneDelegate* sceneDelegate, const SdfPath& rprimId);
+
+    //! The specified Rprim no longer needs full resolution textures.
+    void ReleaseFullResolutionTextures(const SdfPath& rprimId);
+
     //! The specified Rprim starts listening to changes on this material.
     void SubscribeForMaterialUpdates(const SdfPath& rprimId);
 
@@ -120,6 +149,9 @@ public:
 
     static void OnMayaExit();
 
+    static HdVP2TextureDecodeStats GetTextureDecodeStats();
+    static size_t                  GetTextureMemoryUsage();
+
 private:
     class CompiledNetwork
     {
@@ -210,9 +242,17 @@ private:
         const std::string&   path,
         MHWRender::MTexture* texture,
         bool                 isColorSpaceSRGB,
-        const MFloatArray&   uvScaleOffset);
+        const MFloatArray&   uvScaleOffset,
+        bool                 isResolutionCapped);
+    void _EnqueueTextureReload(
+        HdSceneDelegate*   sceneDelegate,
+        const std::string& path,
+        int                maxResolution);
+    void _ReloadCappedTextures();
+    void _DowngradeTextures();
 
     static void _ScheduleRefresh();
+    static void _EvictTexturesToBudget(HdVP2Material* requester);
 
     NetworkConfig _GetCompiledConfig(const TfToken& reprToken) const;
 
@@ -220,6 +260,9 @@ private:
     static std::chrono::steady_clock::time_point _startTime;
     static std::atomic_size_t                    _runningTasksCounter;
 
+    //! Materials holding full resolution textures, least recently upgraded first
+    static std::list<HdVP2Material*> _fullResolutionMaterials;
+
     HdVP2RenderDelegate* const
         _renderDelegate; //!< VP2 render delegate for which this material was created
 
@@ -229,6 +272,24 @@ private:
 
     std::unordered_map<std::string, TextureLoadingTask*> _textureLoadingTasks;
 
+    //! Mutex protecting concurrent access to the texture loading tasks
+    std::mutex _textureLoadingTasksMutex;
+
+    //! Mutex protecting concurrent access to the full resolution Rprim set
+    std::mutex _fullResolutionMutex;
+
+    //! The set of visible and selected Rprims requesting full resolution textures
+    std::set<SdfPath> _fullResolutionRprims;
+
+    //! Paths of the textures upgraded to full resolution for this material
+    std::set<std::string> _upgradedTextures;
+
+    //! Scene delegate used to reload the upgraded textures
+    HdSceneDelegate* _fullResolutionSceneDelegate { nullptr };
+
+    //! Whether a commit task is queued to reload the capped textures at full resolution
+    bool _fullResolutionRequested { false };
+
     //! Mutex protecting concurrent access to the Rprim set
     std::mutex _materialSubscriptionsMutex;
 
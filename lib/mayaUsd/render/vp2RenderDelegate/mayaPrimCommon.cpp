@@ -120,6 +120,15 @@ MayaUsdRPrim::~MayaUsdRPrim()
         ProxyRenderDelegate& drawScene = param->GetDrawScene();
         drawScene.UpdateInstancingMapEntry(_pathInPrototype, sVoidInstancePrototypePath, _hydraId);
     }
+
+    // The render index owns the Rprims, so it is still alive here
+    if (_fullResolutionRenderIndex && !_fullResolutionMaterialId.IsEmpty()) {
+        auto* material = dynamic_cast<HdVP2Material*>(_fullResolutionRenderIndex->GetSprim(
+            HdPrimTypeTokens->material, _fullResolutionMaterialId));
+        if (material) {
+            material->ReleaseFullResolutionTextures(_hydraId);
+        }
+    }
 }
 
 void MayaUsdRPrim::_CommitMVertexBuffer(MHWRender::MVertexBuffer* const buffer, void* bufferData)
@@ -867,6 +876,11 @@ void MayaUsdRPrim::_SyncSharedData(
     if (HdChangeTracker::IsVisibilityDirty(*dirtyBits, id)) {
         sharedData.visible = delegate->GetVisible(id) && _displayLayerModes._visibility;
 
+        // Hidden prims no longer need full resolution textures
+        if (_selectionStatus != kUnselected || !_fullResolutionMaterialId.IsEmpty()) {
+            _UpdateTextureResolution(refThis, delegate);
+        }
+
         // Invisible rprims don't get calls to Sync or _PropagateDirtyBits while
         // they are invisible. This means that when a prim goes from visible to
         // invisible that we must update every repr, because if we switch reprs while
@@ -943,6 +957,7 @@ bool MayaUsdRPrim::_SyncCommon(
     // Update the selection status if it changed.
     if (*dirtyBits & DirtySelectionHighlight) {
         _selectionStatus = drawScene.GetSelectionStatus(id);
+        _UpdateTextureResolution(refThis, delegate);
     } else {
         TF_VERIFY(_selectionStatus == drawScene.GetSelectionStatus(id));
     }
@@ -998,6 +1013,30 @@ MColor MayaUsdRPrim::_GetWireframeColor()
     }
 }
 
+void MayaUsdRPrim::_UpdateTextureResolution(const HdRprim& refThis, HdSceneDelegate* delegate)
+{
+    const SdfPath& materialId = refThis.GetMaterialId();
+    if (materialId.IsEmpty()) {
+        return;
+    }
+
+    auto* material = dynamic_cast<HdVP2Material*>(
+        delegate->GetRenderIndex().GetSprim(HdPrimTypeTokens->material, materialId));
+    if (!material) {
+        return;
+    }
+
+    // Resolution capped textures are loaded at full resolution for visible and selected prims
+    if (_selectionStatus != kUnselected && refThis.IsVisible()) {
+        material->RequestFullResolutionTextures(delegate, refThis.GetId());
+        _fullResolutionMaterialId = materialId;
+        _fullResolutionRenderIndex = &delegate->GetRenderIndex();
+    } else {
+        material->ReleaseFullResolutionTextures(refThis.GetId());
+        _fullResolutionMaterialId = SdfPath();
+    }
+}
+
 SdfPath MayaUsdRPrim::_GetUpdatedMaterialId(HdRprim* rprim, HdSceneDelegate* delegate)
 {
     const SdfPath& id = rprim->GetId();
@@ -1023,6 +1062,10 @@ SdfPath MayaUsdRPrim::_GetUpdatedMaterialId(HdRprim* rprim, HdSceneDelegate* del
                 renderIndex.GetSprim(HdPrimTypeTokens->material, origMaterialId));
             if (material) {
                 material->UnsubscribeFromMaterialUpdates(id);
+                material->ReleaseFullResolutionTextures(id);
+            }
+            if (origMaterialId == _fullResolutionMaterialId) {
+                _fullResolutionMaterialId = SdfPath();
             }
         }
 
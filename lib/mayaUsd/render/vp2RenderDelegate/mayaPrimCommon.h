@@ -326,6 +326,7 @@ protected:
         ErasePrimvarInfoFunc&  erasePrimvarInfo);
 
     SdfPath _GetUpdatedMaterialId(HdRprim* rprim, HdSceneDelegate* delegate);
+    void    _UpdateTextureResolution(const HdRprim& refThis, HdSceneDelegate* delegate);
     MColor  _GetHighlightColor(const TfToken& className);
     MColor  _GetHighlightColor(const TfToken& className, HdVP2SelectionStatus selectionStatus);
     MColor  _GetWireframeColor();
@@ -384,6 +385,10 @@ protected:
     //! Selection status of the Rprim
     HdVP2SelectionStatus _selectionStatus { kUnselected };
 
+    //! Material from which full resolution textures were requested, released on destruction
+    SdfPath        _fullResolutionMaterialId;
+    HdRenderIndex* _fullResolutionRenderIndex { nullptr };
+
     //! Modes requested by display layer along with the frame they are updated on
     bool                           _useInstancedDisplayLayerModes { false };
     DisplayLayerModes              _displayLayerModes;
@@ -49,8 +49,15 @@
 #include <maya/MProfiler.h>
 #include <maya/MSelectionMask.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <numeric>
 #include <type_traits>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -68,6 +75,99 @@ constexpr int sDrawModeSelectionHighlighting = MHWRender::MGeometry::kSelectionH
 constexpr int sDrawModeSelectionHighlighting = 0;
 #endif
 
+//! Primvar fills with fewer elements than this are executed serially, below it the
+//! overhead of spawning worker tasks outweighs the gain.
+constexpr size_t kParallelFillThreshold = 64 * 1024;
+
+//! Grain size used when splitting a primvar fill across worker threads.
+constexpr size_t kParallelFillGrainSize = 16 * 1024;
+
+//! Execute body(begin, end) over [0, count), split across worker threads for large ranges.
+template <class BODY> void _ParallelFill(size_t count, const BODY& body)
+{
+    if (count < kParallelFillThreshold) {
+        body(size_t(0), count);
+        return;
+    }
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, count, kParallelFillGrainSize),
+        [&body](const tbb::blocked_range<size_t>& range) { body(range.begin(), range.end()); });
+}
+
+//! Store a float, float2, float3 or float4 source element into the channels of a
+//! destination element starting at channelOffset. The fixed-size copy lets the compiler
+//! emit vector loads and stores, and is valid for interleaved, unaligned channel offsets
+//! such as opacity packed after a color.
+template <class DEST_TYPE, class SRC_TYPE>
+inline void _StoreChannels(DEST_TYPE* dest, size_t channelOffset, const SRC_TYPE& value)
+{
+    static_assert(
+        sizeof(SRC_TYPE) % sizeof(float) == 0, "Primvar elements are expected to be floats");
+    memcpy(reinterpret_cast<float*>(dest) + channelOffset, &value, sizeof(SRC_TYPE));
+}
+
+//! Broadcast a single value to [begin, end) of the vertex buffer.
+template <class DEST_TYPE, class SRC_TYPE>
+void _BroadcastKernel(
+    DEST_TYPE* const vertexBuffer,
+    size_t           begin,
+    size_t           end,
+    size_t           channelOffset,
+    const SRC_TYPE&  value)
+{
+    for (size_t v = begin; v < end; v++) {
+        _StoreChannels(vertexBuffer + v, channelOffset, value);
+    }
+}
+
+//! Copy primvarData[begin, end) to the same range of the vertex buffer.
+template <class DEST_TYPE, class SRC_TYPE>
+void _CopyKernel(
+    DEST_TYPE* const      vertexBuffer,
+    size_t                begin,
+    size_t                end,
+    size_t                channelOffset,
+    const SRC_TYPE* const primvarData)
+{
+    if (channelOffset == 0 && std::is_same<DEST_TYPE, SRC_TYPE>::value) {
+        memcpy(vertexBuffer + begin, primvarData + begin, sizeof(DEST_TYPE) * (end - begin));
+        return;
+    }
+
+    for (size_t v = begin; v < end; v++) {
+        _StoreChannels(vertexBuffer + v, channelOffset, primvarData[v]);
+    }
+}
+
+//! Gather primvarData[indices[v]] to the vertex buffer for v in [begin, end). Out of range
+//! indices are skipped and counted in numInvalidIndices.
+template <class DEST_TYPE, class SRC_TYPE>
+void _GatherKernel(
+    DEST_TYPE* const      vertexBuffer,
+    size_t                begin,
+    size_t                end,
+    size_t                channelOffset,
+    const SRC_TYPE* const primvarData,
+    const unsigned int    dataSize,
+    const int* const      indices,
+    std::atomic<size_t>&  numInvalidIndices)
+{
+    size_t numInvalid = 0;
+    for (size_t v = begin; v < end; v++) {
+        const unsigned int index = indices[v];
+        if (index < dataSize) {
+            _StoreChannels(vertexBuffer + v, channelOffset, primvarData[index]);
+        } else {
+            ++numInvalid;
+        }
+    }
+
+    if (numInvalid > 0) {
+        numInvalidIndices += numInvalid;
+    }
+}
+
 //! Helper utility function to fill primvar data to vertex buffer.
 template <class DEST_TYPE, class SRC_TYPE>
 void _FillPrimvarData(
@@ -82,34 +182,43 @@ void _FillPrimvarData(
     const HdInterpolation&   primvarInterp)
 {
     switch (primvarInterp) {
-    case HdInterpolationConstant:
-        for (size_t v = 0; v < numVertices; v++) {
-            SRC_TYPE* pointer = reinterpret_cast<SRC_TYPE*>(
-                reinterpret_cast<float*>(&vertexBuffer[v]) + channelOffset);
-            *pointer = primvarData[0];
-        }
+    case HdInterpolationConstant: {
+        const SRC_TYPE& value = primvarData[0];
+        _ParallelFill(numVertices, [&](size_t begin, size_t end) {
+            _BroadcastKernel(vertexBuffer, begin, end, channelOffset, value);
+        });
         break;
+    }
     case HdInterpolationVarying:
     case HdInterpolationVertex:
         if (numVertices <= renderingToSceneFaceVtxIds.size()) {
-            const unsigned int dataSize = primvarData.size();
-            for (size_t v = 0; v < numVertices; v++) {
-                unsigned int index = renderingToSceneFaceVtxIds[v];
-                if (index < dataSize) {
-                    SRC_TYPE* pointer = reinterpret_cast<SRC_TYPE*>(
-                        reinterpret_cast<float*>(&vertexBuffer[v]) + channelOffset);
-                    *pointer = primvarData[index];
-                } else {
-                    TF_DEBUG(HDVP2_DEBUG_MESH)
-                        .Msg(
-                            "Invalid Hydra prim '%s': "
-                            "primvar %s has %u elements, while its topology "
-                            "references face vertex index %u.\n",
-                            rprimId.asChar(),
-                            primvarName.GetText(),
-                            dataSize,
-                            index);
-                }
+            const unsigned int    dataSize = primvarData.size();
+            const SRC_TYPE* const source = primvarData.cdata();
+            const int* const      indices = renderingToSceneFaceVtxIds.cdata();
+
+            std::atomic<size_t> numInvalidIndices(0);
+            _ParallelFill(numVertices, [&](size_t begin, size_t end) {
+                _GatherKernel(
+                    vertexBuffer,
+                    begin,
+                    end,
+                    channelOffset,
+                    source,
+                    dataSize,
+                    indices,
+                    numInvalidIndices);
+            });
+
+            if (numInvalidIndices > 0) {
+                TF_DEBUG(HDVP2_DEBUG_MESH)
+                    .Msg(
+                        "Invalid Hydra prim '%s': "
+                        "primvar %s has %u elements, while its topology "
+                        "references %zu face vertices beyond that.\n",
+                        rprimId.asChar(),
+                        primvarName.GetText(),
+                        dataSize,
+                        numInvalidIndices.load());
             }
         } else {
             TF_CODING_ERROR(
@@ -141,14 +250,33 @@ void _FillPrimvarData(
                         numFaces);
             }
 
-            for (size_t f = 0, v = 0; f < numFaces; f++) {
-                const size_t faceVertexCount = faceVertexCounts[f];
-                const size_t faceVertexEnd = v + faceVertexCount;
-                for (; v < faceVertexEnd; v++) {
-                    SRC_TYPE* pointer = reinterpret_cast<SRC_TYPE*>(
-                        reinterpret_cast<float*>(&vertexBuffer[v]) + channelOffset);
-                    *pointer = primvarData[f];
+            if (numVertices < kParallelFillThreshold) {
+                for (size_t f = 0, v = 0; f < numFaces; f++) {
+                    const size_t faceVertexEnd = v + faceVertexCounts[f];
+                    _BroadcastKernel(vertexBuffer, v, faceVertexEnd, channelOffset, primvarData[f]);
+                    v = faceVertexEnd;
                 }
+            } else {
+                // Compute the first face vertex of each face so faces can be filled
+                // independently.
+                std::vector<size_t> faceVertexBegin(numFaces + 1, 0);
+                std::partial_sum(
+                    faceVertexCounts.cbegin(),
+                    faceVertexCounts.cend(),
+                    faceVertexBegin.begin() + 1);
+
+                tbb::parallel_for(
+                    tbb::blocked_range<size_t>(0, numFaces, kParallelFillGrainSize / 4),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                        for (size_t f = range.begin(); f < range.end(); f++) {
+                            _BroadcastKernel(
+                                vertexBuffer,
+                                faceVertexBegin[f],
+                                faceVertexBegin[f + 1],
+                                channelOffset,
+                                primvarData[f]);
+                        }
+                    });
             }
         } else {
             // The primvar has less data than needed. Issue warning and skip
@@ -189,16 +317,10 @@ void _FillPrimvarData(
                         numVertices);
             }
 
-            if (channelOffset == 0 && std::is_same<DEST_TYPE, SRC_TYPE>::value) {
-                const void* source = static_cast<const void*>(primvarData.cdata());
-                memcpy(vertexBuffer, source, sizeof(DEST_TYPE) * numVertices);
-            } else {
-                for (size_t v = 0; v < numVertices; v++) {
-                    SRC_TYPE* pointer = reinterpret_cast<SRC_TYPE*>(
-                        reinterpret_cast<float*>(&vertexBuffer[v]) + channelOffset);
-                    *pointer = primvarData[v];
-                }
-            }
+            const SRC_TYPE* const source = primvarData.cdata();
+            _ParallelFill(numVertices, [&](size_t begin, size_t end) {
+                _CopyKernel(vertexBuffer, begin, end, channelOffset, source);
+            });
         } else {
             // It is unexpected to have less data than we index into. Issue
             // a warning and skip update.
@@ -226,6 +348,92 @@ void _FillPrimvarData(
     }
 }
 
+/*! \brief  Compute the rendering topology and vertex remap tables of a scene topology.
+
+    The result only depends on the topology and the vertex layout, so it is shared
+    through HdVP2MeshTopologyCache by all the meshes with the same topology.
+*/
+HdVP2MeshTopologyRemapSharedPtr _ComputeTopologyRemap(
+    const HdMeshTopology& topology,
+    bool                  isVertexLayoutUnshared,
+    const SdfPath&        id)
+{
+    auto remap = std::make_shared<HdVP2MeshTopologyRemap>();
+    remap->_topology = topology;
+    remap->_isVertexLayoutUnshared = isVertexLayoutUnshared;
+
+    const VtIntArray& faceVertexIndices = topology.GetFaceVertexIndices();
+    const size_t      numFaceVertexIndices = faceVertexIndices.size();
+
+    VtIntArray newFaceVertexIndices;
+    newFaceVertexIndices.resize(numFaceVertexIndices);
+
+    if (isVertexLayoutUnshared) {
+        remap->_numVertices = numFaceVertexIndices;
+        remap->_renderingToSceneFaceVtxIds = faceVertexIndices;
+        remap->_sceneToRenderingFaceVtxIds.resize(topology.GetNumPoints(), -1);
+
+        for (size_t i = 0; i < numFaceVertexIndices; i++) {
+            const int sceneFaceVtxId = faceVertexIndices[i];
+            remap->_sceneToRenderingFaceVtxIds[sceneFaceVtxId]
+                = i; // could check if the existing value is -1, but it doesn't matter.
+                     // we just need to map to a vertex in the position buffer that has
+                     // the correct value.
+        }
+
+        // Fill with sequentially increasing values, starting from 0. The new
+        // face vertex indices will be used to populate index data for unshared
+        // vertex layout. Note that _FillPrimvarData assumes this sequence to
+        // be used for face-varying primvars and saves lookup and remapping
+        // with _renderingToSceneFaceVtxIds, so in case we change the array we
+        // should update _FillPrimvarData() code to remap indices correctly.
+        std::iota(newFaceVertexIndices.begin(), newFaceVertexIndices.end(), 0);
+    } else {
+        remap->_numVertices = topology.GetNumPoints();
+
+        // Allocate large enough memory with initial value of -1 to indicate
+        // the rendering face vertex index is not determined yet.
+        remap->_sceneToRenderingFaceVtxIds.resize(numFaceVertexIndices, -1);
+        unsigned int sceneToRenderingFaceVtxIdsCount = 0;
+
+        // Sort vertices to avoid drastically jumping indices. Cache efficiency
+        // is important to fast rendering performance for dense mesh.
+        for (size_t i = 0; i < numFaceVertexIndices; i++) {
+            const int sceneFaceVtxId = faceVertexIndices[i];
+
+            int renderFaceVtxId = remap->_sceneToRenderingFaceVtxIds[sceneFaceVtxId];
+            if (renderFaceVtxId < 0) {
+                renderFaceVtxId = remap->_renderingToSceneFaceVtxIds.size();
+                remap->_renderingToSceneFaceVtxIds.push_back(sceneFaceVtxId);
+
+                remap->_sceneToRenderingFaceVtxIds[sceneFaceVtxId] = renderFaceVtxId;
+                sceneToRenderingFaceVtxIdsCount++;
+            }
+
+            newFaceVertexIndices[i] = renderFaceVtxId;
+        }
+
+        remap->_sceneToRenderingFaceVtxIds.resize(
+            sceneToRenderingFaceVtxIdsCount); // drop any extra -1 values.
+    }
+
+    remap->_renderingTopology = HdMeshTopology(
+        topology.GetScheme(),
+        topology.GetOrientation(),
+        topology.GetFaceVertexCounts(),
+        newFaceVertexIndices,
+        topology.GetHoleIndices(),
+        topology.GetRefineLevel());
+
+    // All the render items to draw the shaded (Hull) style share the topology
+    // calculation
+    HdMeshUtil meshUtil(&remap->_renderingTopology, id);
+    meshUtil.ComputeTriangleIndices(
+        &remap->_trianglesFaceVertexIndices, &remap->_primitiveParam, nullptr);
+
+    return remap;
+}
+
 //! If there is uniform or face-varying primvar, we have to create unshared
 //! vertex layout on CPU because SSBO technique is not widely supported by
 //! GPUs and 3D APIs.
@@ -384,6 +592,64 @@ HdVP2Mesh::HdVP2Mesh(HdVP2RenderDelegate* delegate, const SdfPath& id, const Sdf
 #endif
 }
 
+//! \brief  Destructor.
+HdVP2Mesh::~HdVP2Mesh()
+{
+    // Recycle the primvar buffers, unless the shared data is still referenced by a viewport
+    // compute which may access them.
+    HdVP2BufferPool& bufferPool = _delegate->GetVP2BufferPool();
+    if (_meshSharedData && _meshSharedData.use_count() == 1) {
+        for (auto& entry : _meshSharedData->_primvarInfo) {
+            bufferPool.ReleaseVertexBuffer(std::move(entry.second->_buffer));
+        }
+    }
+
+    // The render items are removed along with the draw items, so none can still be bound to
+    // the buffers of removed primvars once the pool makes them available.
+    for (auto& removed : _removedPrimvarBuffers) {
+        bufferPool.ReleaseVertexBuffer(std::move(removed.second));
+    }
+}
+
+/*! \brief  Recycle the buffers of removed primvars which no render item is bound to anymore.
+
+    A render item stops referencing the removed buffers once its geometry is committed with a
+    later primvar generation. Render items which were never committed since then, e.g. the ones
+    of inactive reprs, keep the buffers alive until they are.
+*/
+void HdVP2Mesh::_ReleaseUnboundPrimvarBuffers()
+{
+    if (_removedPrimvarBuffers.empty()) {
+        return;
+    }
+
+    size_t boundGeneration = _primvarGeneration;
+    for (const std::pair<TfToken, HdReprSharedPtr>& pair : _reprs) {
+        const auto& items = pair.second->GetDrawItems();
+#if HD_API_VERSION < 35
+        for (HdDrawItem* item : items) {
+            HdVP2DrawItem* drawItem = static_cast<HdVP2DrawItem*>(item);
+#else
+        for (const HdRepr::DrawItemUniquePtr& item : items) {
+            HdVP2DrawItem* drawItem = static_cast<HdVP2DrawItem*>(item.get());
+#endif
+            for (auto mod = drawItem; mod; mod = mod->GetMod()) {
+                for (const auto& renderItemData : mod->GetRenderItems()) {
+                    boundGeneration
+                        = std::min(boundGeneration, renderItemData._primvarGeneration);
+                }
+            }
+        }
+    }
+
+    HdVP2BufferPool& bufferPool = _delegate->GetVP2BufferPool();
+    auto             it = _removedPrimvarBuffers.begin();
+    for (; it != _removedPrimvarBuffers.end() && it->first <= boundGeneration; ++it) {
+        bufferPool.ReleaseVertexBuffer(std::move(it->second));
+    }
+    _removedPrimvarBuffers.erase(_removedPrimvarBuffers.begin(), it);
+}
+
 void HdVP2Mesh::_PrepareSharedVertexBuffers(
     HdSceneDelegate*   delegate,
     const HdDirtyBits& rprimDirtyBits,
@@ -540,7 +806,8 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                 const MHWRender::MVertexBufferDescriptor vbDesc(
                     "", MHWRender::MGeometry::kColor, MHWRender::MGeometry::kFloat, 4);
 
-                colorAndOpacityInfo->_buffer.reset(new MHWRender::MVertexBuffer(vbDesc));
+                colorAndOpacityInfo->_buffer = _delegate->GetVP2BufferPool().AcquireVertexBuffer(
+                    vbDesc, _meshSharedData->_numVertices);
             }
 
             void* bufferData = _meshSharedData->_numVertices > 0
@@ -616,8 +883,10 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     const MHWRender::MVertexBufferDescriptor vbDesc(
                         "", semantic, MHWRender::MGeometry::kFloat, 1);
 
-                    buffer = new MHWRender::MVertexBuffer(vbDesc);
-                    _meshSharedData->_primvarInfo[token]->_buffer.reset(buffer);
+                    auto& primvarBuffer = _meshSharedData->_primvarInfo[token]->_buffer;
+                    primvarBuffer = _delegate->GetVP2BufferPool().AcquireVertexBuffer(
+                        vbDesc, _meshSharedData->_numVertices);
+                    buffer = primvarBuffer.get();
                 }
 
                 if (buffer) {
@@ -642,8 +911,10 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     const MHWRender::MVertexBufferDescriptor vbDesc(
                         "", semantic, MHWRender::MGeometry::kFloat, 2);
 
-                    buffer = new MHWRender::MVertexBuffer(vbDesc);
-                    _meshSharedData->_primvarInfo[token]->_buffer.reset(buffer);
+                    auto& primvarBuffer = _meshSharedData->_primvarInfo[token]->_buffer;
+                    primvarBuffer = _delegate->GetVP2BufferPool().AcquireVertexBuffer(
+                        vbDesc, _meshSharedData->_numVertices);
+                    buffer = primvarBuffer.get();
                 }
 
                 if (buffer) {
@@ -668,8 +939,10 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     const MHWRender::MVertexBufferDescriptor vbDesc(
                         "", semantic, MHWRender::MGeometry::kFloat, 3);
 
-                    buffer = new MHWRender::MVertexBuffer(vbDesc);
-                    _meshSharedData->_primvarInfo[token]->_buffer.reset(buffer);
+                    auto& primvarBuffer = _meshSharedData->_primvarInfo[token]->_buffer;
+                    primvarBuffer = _delegate->GetVP2BufferPool().AcquireVertexBuffer(
+                        vbDesc, _meshSharedData->_numVertices);
+                    buffer = primvarBuffer.get();
                 }
 
                 if (buffer) {
@@ -694,8 +967,10 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     const MHWRender::MVertexBufferDescriptor vbDesc(
                         "", semantic, MHWRender::MGeometry::kFloat, 4);
 
-                    buffer = new MHWRender::MVertexBuffer(vbDesc);
-                    _meshSharedData->_primvarInfo[token]->_buffer.reset(buffer);
+                    auto& primvarBuffer = _meshSharedData->_primvarInfo[token]->_buffer;
+                    primvarBuffer = _delegate->GetVP2BufferPool().AcquireVertexBuffer(
+                        vbDesc, _meshSharedData->_numVertices);
+                    buffer = primvarBuffer.get();
                 }
 
                 if (buffer) {
@@ -720,8 +995,10 @@ void HdVP2Mesh::_PrepareSharedVertexBuffers(
                     const MHWRender::MVertexBufferDescriptor vbDesc(
                         "", semantic, MHWRender::MGeometry::kFloat, 1); // kInt32
 
-                    buffer = new MHWRender::MVertexBuffer(vbDesc);
-                    _meshSharedData->_primvarInfo[token]->_buffer.reset(buffer);
+                    auto& primvarBuffer = _meshSharedData->_primvarInfo[token]->_buffer;
+                    primvarBuffer = _delegate->GetVP2BufferPool().AcquireVertexBuffer(
+                        vbDesc, _meshSharedData->_numVertices);
+                    buffer = primvarBuffer.get();
                 }
 
                 if (buffer) {
@@ -795,6 +1072,9 @@ void HdVP2Mesh::Sync(
         _rprimId.asChar(),
         "HdVP2Mesh::Sync");
 
+    // The previous commits may have unbound the buffers of removed primvars.
+    _ReleaseUnboundPrimvarBuffers();
+
     const SdfPath& id = GetId();
     HdRenderIndex& renderIndex = delegate->GetRenderIndex();
 
@@ -941,82 +1221,33 @@ void HdVP2Mesh::Sync(
             _rprimId.asChar(),
             "HdVP2Mesh Create Rendering Topology");
 
-        const HdMeshTopology& topology = _meshSharedData->_topology;
-        const VtIntArray&     faceVertexIndices = topology.GetFaceVertexIndices();
-        const size_t          numFaceVertexIndices = faceVertexIndices.size();
-
-        VtIntArray newFaceVertexIndices;
-        newFaceVertexIndices.resize(numFaceVertexIndices);
-
-        if (_meshSharedData->_isVertexLayoutUnshared) {
-            _meshSharedData->_numVertices = numFaceVertexIndices;
-            _meshSharedData->_renderingToSceneFaceVtxIds = faceVertexIndices;
-            _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(topology.GetNumPoints(), -1);
-
-            for (size_t i = 0; i < numFaceVertexIndices; i++) {
-                const int sceneFaceVtxId = faceVertexIndices[i];
-                _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId]
-                    = i; // could check if the existing value is -1, but it doesn't matter.
-                         // we just need to map to a vertex in the position buffer that has
-                         // the correct value.
-            }
-
-            // Fill with sequentially increasing values, starting from 0. The new
-            // face vertex indices will be used to populate index data for unshared
-            // vertex layout. Note that _FillPrimvarData assumes this sequence to
-            // be used for face-varying primvars and saves lookup and remapping
-            // with _renderingToSceneFaceVtxIds, so in case we change the array we
-            // should update _FillPrimvarData() code to remap indices correctly.
-            std::iota(newFaceVertexIndices.begin(), newFaceVertexIndices.end(), 0);
-        } else {
-            _meshSharedData->_numVertices = topology.GetNumPoints();
-            _meshSharedData->_renderingToSceneFaceVtxIds.clear();
-
-            // Allocate large enough memory with initial value of -1 to indicate
-            // the rendering face vertex index is not determined yet.
-            _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(numFaceVertexIndices, -1);
-            unsigned int sceneToRenderingFaceVtxIdsCount = 0;
-
-            // Sort vertices to avoid drastically jumping indices. Cache efficiency
-            // is important to fast rendering performance for dense mesh.
-            for (size_t i = 0; i < numFaceVertexIndices; i++) {
-                const int sceneFaceVtxId = faceVertexIndices[i];
-
-                int renderFaceVtxId = _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId];
-                if (renderFaceVtxId < 0) {
-                    renderFaceVtxId = _meshSharedData->_renderingToSceneFaceVtxIds.size();
-                    _meshSharedData->_renderingToSceneFaceVtxIds.push_back(sceneFaceVtxId);
-
-                    _meshSharedData->_sceneToRenderingFaceVtxIds[sceneFaceVtxId] = renderFaceVtxId;
-                    sceneToRenderingFaceVtxIdsCount++;
-                }
-
-                newFaceVertexIndices[i] = renderFaceVtxId;
-            }
+        // Only the parts of the topology used to compute the rendering topology are part of
+        // the cache key, so meshes differing e.g. by geom subsets still share the remap.
+        const HdMeshTopology& sceneTopology = _meshSharedData->_topology;
+        const HdMeshTopology  topology(
+            sceneTopology.GetScheme(),
+            sceneTopology.GetOrientation(),
+            sceneTopology.GetFaceVertexCounts(),
+            sceneTopology.GetFaceVertexIndices(),
+            sceneTopology.GetHoleIndices(),
+            sceneTopology.GetRefineLevel());
+
+        HdVP2MeshTopologyCache& topologyCache = _delegate->GetMeshTopologyCache();
+        HdVP2MeshTopologyRemapSharedPtr remap
+            = topologyCache.Find(topology, _meshSharedData->_isVertexLayoutUnshared);
+        if (!remap) {
+            remap = topologyCache.Insert(_ComputeTopologyRemap(
+                topology, _meshSharedData->_isVertexLayoutUnshared, GetId()));
+        }
 
-            _meshSharedData->_sceneToRenderingFaceVtxIds.resize(
-                sceneToRenderingFaceVtxIdsCount); // drop any extra -1 values.
-        }
-
-        _meshSharedData->_renderingTopology = HdMeshTopology(
-            topology.GetScheme(),
-            topology.GetOrientation(),
-            topology.GetFaceVertexCounts(),
-            newFaceVertexIndices,
-            topology.GetHoleIndices(),
-            topology.GetRefineLevel());
-
-        // All the render items to draw the shaded (Hull) style share the topology
-        // calculation
-        HdMeshUtil meshUtil(&_meshSharedData->_renderingTopology, GetId());
-        _meshSharedData->_trianglesFaceVertexIndices.clear();
-        _meshSharedData->_primitiveParam.clear();
-        meshUtil.ComputeTriangleIndices(
-            &_meshSharedData->_trianglesFaceVertexIndices,
-            &_meshSharedData->_primitiveParam,
-            nullptr);
+        _meshSharedData->_topologyRemap = remap;
+        _meshSharedData->_numVertices = remap->_numVertices;
+        _meshSharedData->_renderingToSceneFaceVtxIds = remap->_renderingToSceneFaceVtxIds;
+        _meshSharedData->_sceneToRenderingFaceVtxIds = std::shared_ptr<const std::vector<int>>(
+            remap, &remap->_sceneToRenderingFaceVtxIds);
+        _meshSharedData->_renderingTopology = remap->_renderingTopology;
+        _meshSharedData->_trianglesFaceVertexIndices = remap->_trianglesFaceVertexIndices;
+        _meshSharedData->_primitiveParam = remap->_primitiveParam;
 
         // Decide if we should use GPU compute, and set up compute objects for later user
 #ifdef HDVP2_ENABLE_GPU_COMPUTE
@@ -2174,6 +2405,7 @@ void HdVP2Mesh::_UpdateDrawItem(
     MHWRender::MIndexBuffer* indexBuffer = drawItemData._indexBuffer.get();
     PrimvarInfoMap*          primvarInfo = &_meshSharedData->_primvarInfo;
     TfTokenVector*           primvars = &_meshSharedData->_allRequiredPrimvars;
+    const size_t             primvarGeneration = _primvarGeneration;
     const HdVP2BBoxGeom&     sharedBBoxGeom = _delegate->GetSharedBBoxGeom();
     if (isBBoxItem) {
         indexBuffer = const_cast<MHWRender::MIndexBuffer*>(sharedBBoxGeom.GetIndexBuffer());
@@ -2187,6 +2419,7 @@ void HdVP2Mesh::_UpdateDrawItem(
                                                            param,
                                                            primvarInfo,
                                                            primvars,
+                                                           primvarGeneration,
                                                            indexBuffer,
                                                            isBBoxItem,
                                                            &sharedBBoxGeom]() {
@@ -2271,6 +2504,7 @@ void HdVP2Mesh::_UpdateDrawItem(
                 result = drawScene.setGeometryForRenderItem(
                     *renderItem, vertexBuffers, *indexBuffer, stateToCommit._boundingBox);
                 TF_VERIFY(result == MStatus::kSuccess);
+                stateToCommit._renderItemData._primvarGeneration = primvarGeneration;
             }
 
             // Important, update instance transforms after setting geometry on render items!
@@ -2515,8 +2749,18 @@ void HdVP2Mesh::_UpdatePrimvarSources(
 
     const SdfPath& id = GetId();
 
-    ErasePrimvarInfoFunc erasePrimvarInfo
-        = [this](const TfToken& name) { _meshSharedData->_primvarInfo.erase(name); };
+    // The buffer of a removed primvar may still be bound to render items, until they are
+    // committed again without it. See _ReleaseUnboundPrimvarBuffers().
+    ErasePrimvarInfoFunc erasePrimvarInfo = [this](const TfToken& name) {
+        auto it = _meshSharedData->_primvarInfo.find(name);
+        if (it != _meshSharedData->_primvarInfo.end()) {
+            if (it->second->_buffer) {
+                _removedPrimvarBuffers.emplace_back(
+                    ++_primvarGeneration, std::move(it->second->_buffer));
+            }
+            _meshSharedData->_primvarInfo.erase(it);
+        }
+    };
 
     UpdatePrimvarInfoFunc updatePrimvarInfo
         = [&](const TfToken& name, const VtValue& value, const HdInterpolation interpolation) {
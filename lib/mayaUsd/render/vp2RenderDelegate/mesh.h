@@ -16,8 +16,10 @@
 #ifndef HD_VP2_MESH
 #define HD_VP2_MESH
 
+#include "buffer_pool.h"
 #include "draw_item.h"
 #include "mayaPrimCommon.h"
+#include "meshTopologyCache.h"
 #include "meshViewportCompute.h"
 #include "primvarInfo.h"
 
@@ -29,6 +31,10 @@
 
 #include <maya/MHWGeometry.h>
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 class HdSceneDelegate;
@@ -52,6 +58,10 @@ struct HdVP2MeshSharedData
     //! Adjacency based off of _topology
     Hd_VertexAdjacencySharedPtr _adjacency;
 
+    //! Rendering topology and remap tables shared with the meshes of the same topology,
+    //! through the render delegate HdVP2MeshTopologyCache.
+    HdVP2MeshTopologyRemapSharedPtr _topologyRemap;
+
     //! The rendering topology is to create unshared or sorted vertice layout
     //! for efficient GPU rendering.
     HdMeshTopology _renderingTopology;
@@ -64,8 +74,8 @@ struct HdVP2MeshSharedData
     VtIntArray _renderingToSceneFaceVtxIds;
 
     //! An array to store a rendering face vertex index for each original scene
-    //! face vertex index.
-    std::vector<int> _sceneToRenderingFaceVtxIds;
+    //! face vertex index. Points into _topologyRemap, unless the topology is consolidated.
+    std::shared_ptr<const std::vector<int>> _sceneToRenderingFaceVtxIds;
 
     //! triangulation of the _renderingTopology
     VtVec3iArray _trianglesFaceVertexIndices;
@@ -120,7 +130,7 @@ public:
 #endif
 
     //! Destructor.
-    ~HdVP2Mesh() override = default;
+    ~HdVP2Mesh() override;
 
     void Sync(HdSceneDelegate*, HdRenderParam*, HdDirtyBits*, const TfToken& reprToken) override;
 
@@ -199,6 +209,8 @@ private:
 
     void _ResetRenderingTopology();
 
+    void _ReleaseUnboundPrimvarBuffers();
+
     static void _InitGPUCompute();
 
     //! Custom dirty bits used by this mesh
@@ -219,6 +231,13 @@ private:
     std::shared_ptr<HdVP2MeshSharedData>
         _meshSharedData; //!< Shared data for all draw items of the Rprim
 
+    //! Generation of the primvar buffers, incremented when a primvar is removed.
+    size_t _primvarGeneration { 0 };
+
+    //! Buffers of removed primvars, along with the generation at which they were removed. They
+    //! may still be bound to render items until these are committed with a later generation.
+    std::vector<std::pair<size_t, HdVP2BufferPool::VertexBufferPtr>> _removedPrimvarBuffers;
+
     //! Control GPU compute behavior
     //! Having these in place even without HDVP2_ENABLE_GPU_COMPUTE or HDVP2_ENABLE_GPU_OSD
     //! defined makes the expressions using these variables much simpler
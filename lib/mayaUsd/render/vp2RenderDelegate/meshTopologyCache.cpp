@@ -0,0 +1,168 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "meshTopologyCache.h"
+
+#include <iterator>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+size_t _TopologyMemoryUsage(const HdMeshTopology& topology)
+{
+    return sizeof(int)
+        * (topology.GetFaceVertexCounts().size() + topology.GetFaceVertexIndices().size()
+           + topology.GetHoleIndices().size());
+}
+
+} // namespace
+
+size_t HdVP2MeshTopologyRemap::GetMemoryUsage() const
+{
+    // The scene topology is owned by the meshes, only count the data computed for the remap.
+    return sizeof(HdVP2MeshTopologyRemap) + sizeof(int) * _renderingToSceneFaceVtxIds.size()
+        + sizeof(int) * _sceneToRenderingFaceVtxIds.size()
+        + _TopologyMemoryUsage(_renderingTopology)
+        + sizeof(GfVec3i) * _trianglesFaceVertexIndices.size()
+        + sizeof(int) * _primitiveParam.size();
+}
+
+/*! \brief  Return the remap computed for the given topology and vertex layout, or nullptr.
+ */
+HdVP2MeshTopologyRemapSharedPtr
+HdVP2MeshTopologyCache::Find(const HdMeshTopology& topology, bool isVertexLayoutUnshared)
+{
+    const size_t key = _ComputeKey(topology, isVertexLayoutUnshared);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto range = _entries.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        const HdVP2MeshTopologyRemapSharedPtr& remap = it->second->second;
+        if (remap->_isVertexLayoutUnshared == isVertexLayoutUnshared
+            && remap->_topology == topology) {
+            // Move the entry to the front of the LRU list.
+            _lru.splice(_lru.begin(), _lru, it->second);
+            ++_hitCount;
+            return remap;
+        }
+    }
+
+    ++_missCount;
+    return nullptr;
+}
+
+/*! \brief  Insert a newly computed remap, and return the cached remap for its topology.
+
+    If another thread inserted a remap for the same topology in the meantime, that remap
+    is returned so all meshes share the same data.
+*/
+HdVP2MeshTopologyRemapSharedPtr
+HdVP2MeshTopologyCache::Insert(HdVP2MeshTopologyRemapSharedPtr remap)
+{
+    if (!remap)
+        return remap;
+
+    const size_t key = _ComputeKey(remap->_topology, remap->_isVertexLayoutUnshared);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto range = _entries.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        const HdVP2MeshTopologyRemapSharedPtr& cached = it->second->second;
+        if (cached->_isVertexLayoutUnshared == remap->_isVertexLayoutUnshared
+            && cached->_topology == remap->_topology) {
+            return cached;
+        }
+    }
+
+    _lru.emplace_front(key, remap);
+    _entries.emplace(key, _lru.begin());
+    _memoryUsage += remap->GetMemoryUsage();
+
+    _EvictToBudget();
+
+    return remap;
+}
+
+/*! \brief  Remove all entries from the cache. Meshes keep the remaps they reference.
+ */
+void HdVP2MeshTopologyCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _lru.clear();
+    _memoryUsage = 0;
+}
+
+/*! \brief  Set the memory budget of the cache, evicting least recently used entries if needed.
+ */
+void HdVP2MeshTopologyCache::SetMemoryBudget(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _memoryBudget = bytes;
+    _EvictToBudget();
+}
+
+size_t HdVP2MeshTopologyCache::GetMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memoryUsage;
+}
+
+size_t HdVP2MeshTopologyCache::GetHitCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hitCount;
+}
+
+size_t HdVP2MeshTopologyCache::GetMissCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _missCount;
+}
+
+size_t
+HdVP2MeshTopologyCache::_ComputeKey(const HdMeshTopology& topology, bool isVertexLayoutUnshared)
+{
+    const size_t hash = static_cast<size_t>(topology.ComputeHash());
+    return isVertexLayoutUnshared ? ~hash : hash;
+}
+
+/*! \brief  Evict least recently used entries until the cache fits its memory budget.
+
+    Must be called with _mutex locked. The most recently used entry is never evicted,
+    so a single topology larger than the budget is still shared while it is in use.
+*/
+void HdVP2MeshTopologyCache::_EvictToBudget()
+{
+    while (_memoryUsage > _memoryBudget && _lru.size() > 1) {
+        auto lruIt = std::prev(_lru.end());
+
+        auto range = _entries.equal_range(lruIt->first);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == lruIt) {
+                _entries.erase(it);
+                break;
+            }
+        }
+
+        _memoryUsage -= lruIt->second->GetMemoryUsage();
+        _lru.erase(lruIt);
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,128 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef HD_VP2_MESH_TOPOLOGY_CACHE
+#define HD_VP2_MESH_TOPOLOGY_CACHE
+
+#include <pxr/base/gf/vec3i.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/imaging/hd/meshTopology.h>
+#include <pxr/pxr.h>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/*! \brief  Rendering topology and vertex remap tables computed from a scene topology.
+    \struct HdVP2MeshTopologyRemap
+
+    The data is immutable once inserted in HdVP2MeshTopologyCache, so it can be shared by
+    all the meshes with the same topology. VtArrays are reference counted, copying them
+    out of the remap does not copy their buffers.
+*/
+struct HdVP2MeshTopologyRemap
+{
+    //! Scene topology the remap was computed from, used to resolve hash collisions.
+    HdMeshTopology _topology;
+
+    //! Whether the remap was computed for an unshared vertex layout.
+    bool _isVertexLayoutUnshared { false };
+
+    //! The number of vertices in each vertex buffer.
+    size_t _numVertices { 0 };
+
+    //! Original scene face vertex index of each rendering face vertex index.
+    VtIntArray _renderingToSceneFaceVtxIds;
+
+    //! Rendering face vertex index of each original scene face vertex index.
+    std::vector<int> _sceneToRenderingFaceVtxIds;
+
+    //! Topology with unshared or sorted vertex layout for efficient GPU rendering.
+    HdMeshTopology _renderingTopology;
+
+    //! Triangulation of _renderingTopology.
+    VtVec3iArray _trianglesFaceVertexIndices;
+
+    //! Encoded triangleId to faceId of _trianglesFaceVertexIndices.
+    VtIntArray _primitiveParam;
+
+    //! Approximate memory held by the remap, in bytes.
+    size_t GetMemoryUsage() const;
+};
+
+using HdVP2MeshTopologyRemapSharedPtr = std::shared_ptr<const HdVP2MeshTopologyRemap>;
+
+/*! \brief  Render delegate wide cache of mesh topology remaps, keyed by topology hash.
+    \class  HdVP2MeshTopologyCache
+
+    Meshes sharing the same topology (e.g. non-natively instanced crowds, or variant
+    switches back to a previously seen shape) compute their rendering topology once.
+    Entries are reference counted, and least recently used entries are evicted when the
+    cache exceeds its memory budget. Evicted entries stay alive as long as a mesh
+    references them.
+
+    The cache is thread safe, it is accessed from Sync on worker threads.
+*/
+class HdVP2MeshTopologyCache
+{
+public:
+    HdVP2MeshTopologyCache() = default;
+    ~HdVP2MeshTopologyCache() = default;
+
+    HdVP2MeshTopologyRemapSharedPtr
+    Find(const HdMeshTopology& topology, bool isVertexLayoutUnshared);
+
+    HdVP2MeshTopologyRemapSharedPtr Insert(HdVP2MeshTopologyRemapSharedPtr remap);
+
+    void Clear();
+
+    void   SetMemoryBudget(size_t bytes);
+    size_t GetMemoryUsage() const;
+    size_t GetHitCount() const;
+    size_t GetMissCount() const;
+
+private:
+    HdVP2MeshTopologyCache(const HdVP2MeshTopologyCache&) = delete;
+    HdVP2MeshTopologyCache& operator=(const HdVP2MeshTopologyCache&) = delete;
+
+    //! Entries with their key, most recently used entries at the front.
+    using LruList = std::list<std::pair<size_t, HdVP2MeshTopologyRemapSharedPtr>>;
+
+    static size_t _ComputeKey(const HdMeshTopology& topology, bool isVertexLayoutUnshared);
+
+    void _EvictToBudget();
+
+    mutable std::mutex _mutex; //!< Protects all the members below
+
+    LruList _lru;
+
+    //! Entries with the same key are topologies with colliding hashes.
+    std::unordered_multimap<size_t, LruList::iterator> _entries;
+
+    size_t _memoryUsage { 0 };
+    size_t _memoryBudget { 512 * 1024 * 1024 };
+    size_t _hitCount { 0 };
+    size_t _missCount { 0 };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_VP2_MESH_TOPOLOGY_CACHE
@@ -259,8 +259,10 @@ void MeshViewportCompute::createConsolidatedTopology(TopologyAccessor getTopolog
         holeIndices.reserve(holeIndicesSize);
         _meshSharedData->_renderingToSceneFaceVtxIds.clear();
         _meshSharedData->_renderingToSceneFaceVtxIds.reserve(vertexCount);
-        _meshSharedData->_sceneToRenderingFaceVtxIds.clear();
-        _meshSharedData->_sceneToRenderingFaceVtxIds.reserve(sceneToRenderingFaceVtxIdsCount);
+        // The remap of a single mesh is shared through the topology cache, so the consolidated
+        // remap is built in a new array.
+        std::vector<int> sceneToRenderingFaceVtxIds;
+        sceneToRenderingFaceVtxIds.reserve(sceneToRenderingFaceVtxIdsCount);
 
         for (int sourceIndex = 0; sourceIndex < _geometryIndexMapping->geometryCount();
              sourceIndex++) {
@@ -314,18 +316,20 @@ void MeshViewportCompute::createConsolidatedTopology(TopologyAccessor getTopolog
 
             // add padding to _sceneToRenderingFaceVtxIds because the scene IDs start at
             // consolidatedBufferVertexOffset
-            while (consolidatedBufferVertexOffset
-                   > _meshSharedData->_sceneToRenderingFaceVtxIds.size()) {
-                _meshSharedData->_sceneToRenderingFaceVtxIds.push_back(-1);
+            while (consolidatedBufferVertexOffset > sceneToRenderingFaceVtxIds.size()) {
+                sceneToRenderingFaceVtxIds.push_back(-1);
             }
 
-            for (size_t idx = 0; idx < sourceMeshSharedData->_sceneToRenderingFaceVtxIds.size();
-                 idx++) {
-                _meshSharedData->_sceneToRenderingFaceVtxIds.push_back(
-                    sourceMeshSharedData->_sceneToRenderingFaceVtxIds[idx]
-                    + consolidatedBufferVertexOffset);
+            if (sourceMeshSharedData->_sceneToRenderingFaceVtxIds) {
+                for (int sceneToRenderingFaceVtxId :
+                     *sourceMeshSharedData->_sceneToRenderingFaceVtxIds) {
+                    sceneToRenderingFaceVtxIds.push_back(
+                        sceneToRenderingFaceVtxId + consolidatedBufferVertexOffset);
+                }
             }
         }
+        _meshSharedData->_sceneToRenderingFaceVtxIds
+            = std::make_shared<const std::vector<int>>(std::move(sceneToRenderingFaceVtxIds));
 
         HdMeshTopology consolidatedTopology(
             scheme, orientation, faceVertexCounts, faceVertexIndices, holeIndices, refineLevel);
@@ -740,13 +744,17 @@ void MeshViewportCompute::prepareAdjacencyBuffer()
         _meshSharedData->_renderingToSceneFaceVtxIds.size() * sizeof(int));
     _renderingToSceneFaceVtxIdsGPU->commit(bufferData);
 
+    static const std::vector<int> emptyFaceVtxIds;
+    const std::vector<int>&       sceneToRenderingFaceVtxIds
+        = _meshSharedData->_sceneToRenderingFaceVtxIds
+        ? *_meshSharedData->_sceneToRenderingFaceVtxIds
+        : emptyFaceVtxIds;
     _sceneToRenderingFaceVtxIdsGPU.reset(new MHWRender::MVertexBuffer(intArrayDesc));
-    bufferData = _sceneToRenderingFaceVtxIdsGPU->acquire(
-        _meshSharedData->_sceneToRenderingFaceVtxIds.size(), true);
+    bufferData = _sceneToRenderingFaceVtxIdsGPU->acquire(sceneToRenderingFaceVtxIds.size(), true);
     memcpy(
         bufferData,
-        _meshSharedData->_sceneToRenderingFaceVtxIds.data(),
-        _meshSharedData->_sceneToRenderingFaceVtxIds.size() * sizeof(int));
+        sceneToRenderingFaceVtxIds.data(),
+        sceneToRenderingFaceVtxIds.size() * sizeof(int));
     _sceneToRenderingFaceVtxIdsGPU->commit(bufferData);
 #endif
 }
@@ -72,6 +72,8 @@
 #include <maya/MNodeMessage.h>
 #endif
 
+#include <algorithm>
+
 #if defined(WANT_UFE_BUILD)
 #include <mayaUsd/ufe/Global.h>
 #include <mayaUsd/ufe/Utils.h>
@@ -93,6 +95,8 @@
 #include <ufe/sceneItem.h>
 #include <ufe/sceneNotification.h>
 #include <ufe/selectionNotification.h>
+
+#include <unordered_set>
 #endif
 
 #if defined(BUILD_HDMAYA)
@@ -1810,30 +1814,160 @@ void ProxyRenderDelegate::ColorManagementRefresh()
 }
 
 //! \brief  Populate lead and active selection for Rprims under the proxy shape.
-void ProxyRenderDelegate::_PopulateSelection()
+//!
+//! The rprims selected by each UFE scene item are kept between calls, so that only the items
+//! added to the selection need to be populated. When \p changedRprims is given, the rprims whose
+//! selection state may have changed are appended to it.
+void ProxyRenderDelegate::_PopulateSelection(SdfPathVector* changedRprims)
 {
 #if defined(WANT_UFE_BUILD)
     if (_proxyShapeData->ProxyShape() == nullptr) {
         return;
     }
 
-    _leadSelection.reset(new HdSelection);
-    _activeSelection.reset(new HdSelection);
+    // Above this number of added, removed or lead items, the rprims of the previous and new
+    // selections are all reported as changed rather than tracked per item.
+    constexpr size_t kMaxIncrementalSelectionChanges = 1024;
 
     const auto proxyPath = _proxyShapeData->ProxyShape()->ufePath();
     const auto globalSelection = Ufe::GlobalSelection::get();
 
-    // Populate lead selection from the last item in UFE global selection.
-    auto it = globalSelection->crbegin();
-    if (it != globalSelection->crend()) {
-        PopulateSelection(*it, proxyPath, *_sceneDelegate, _leadSelection);
+    // The fragments refer to rprims and instance indices, which may change with the scene.
+    const unsigned int sceneStateVersion
+        = _renderIndex->GetChangeTracker().GetSceneStateVersion();
+    bool incremental = (sceneStateVersion == _selectionSceneStateVersion);
+    if (!incremental) {
+        _selectionFragments.clear();
+    }
+
+    // Collect the USD items under the proxy shape. The lead item is the last one of the UFE
+    // global selection.
+    std::vector<UsdUfe::UsdSceneItem::Ptr> items;
+    std::unordered_set<Ufe::Path>          selectedPaths;
+    Ufe::Path                              leadPath;
+    for (auto it = globalSelection->crbegin(); it != globalSelection->crend(); ++it) {
+        if (!(*it)->path().startsWith(proxyPath)) {
+            continue;
+        }
+        auto usdItem = std::dynamic_pointer_cast<UsdUfe::UsdSceneItem>(*it);
+        if (!usdItem) {
+            continue;
+        }
+        if (it == globalSelection->crbegin()) {
+            leadPath = usdItem->path();
+        }
+        items.push_back(usdItem);
+        selectedPaths.insert(usdItem->path());
+    }
+
+    // The items that are added or removed, and the previous and new lead items, change the
+    // selection state of their rprims.
+    std::vector<Ufe::Path> changedItems;
+    for (const auto& fragment : _selectionFragments) {
+        if (selectedPaths.find(fragment.first) == selectedPaths.end()) {
+            changedItems.push_back(fragment.first);
+        }
+    }
+    for (const auto& item : items) {
+        if (_selectionFragments.find(item->path()) == _selectionFragments.end()) {
+            changedItems.push_back(item->path());
+        }
+    }
+    if (leadPath != _leadSelectionPath) {
+        if (!_leadSelectionPath.empty()) {
+            changedItems.push_back(_leadSelectionPath);
+        }
+        if (!leadPath.empty()) {
+            changedItems.push_back(leadPath);
+        }
+    }
+    incremental = incremental && (changedItems.size() <= kMaxIncrementalSelectionChanges);
+
+    auto appendFragmentRprims = [this, changedRprims](const Ufe::Path& path) {
+        auto found = _selectionFragments.find(path);
+        if (found != _selectionFragments.end()) {
+            for (const auto& rprimState : found->second) {
+                changedRprims->push_back(rprimState.first);
+            }
+        }
+    };
+
+    if (changedRprims) {
+        if (incremental) {
+            // The fragments of the removed items are still there.
+            for (const Ufe::Path& path : changedItems) {
+                appendFragmentRprims(path);
+            }
+        } else {
+            AppendSelectedPrimPaths(_leadSelection, *changedRprims);
+            AppendSelectedPrimPaths(_activeSelection, *changedRprims);
+        }
+    }
+
+    // Remove the fragments of the deselected items, and populate the ones of the new items.
+    for (auto it = _selectionFragments.begin(); it != _selectionFragments.end();) {
+        if (selectedPaths.find(it->first) == selectedPaths.end()) {
+            it = _selectionFragments.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (const auto& item : items) {
+        auto inserted = _selectionFragments.emplace(item->path(), _SelectionFragment());
+        if (!inserted.second) {
+            continue;
+        }
 
-        // Start reverse iteration from the second last item in UFE global
-        // selection and populate active selection.
-        for (it++; it != globalSelection->crend(); it++) {
-            PopulateSelection(*it, proxyPath, *_sceneDelegate, _activeSelection);
+        HdSelectionSharedPtr itemSelection(new HdSelection);
+        PopulateSelection(item, proxyPath, *_sceneDelegate, itemSelection);
+
+        _SelectionFragment& fragment = inserted.first->second;
+        for (const SdfPath& rprim :
+             itemSelection->GetSelectedPrimPaths(HdSelection::HighlightModeSelect)) {
+            fragment.emplace_back(
+                rprim,
+                *itemSelection->GetPrimSelectionState(HdSelection::HighlightModeSelect, rprim));
         }
     }
+
+    if (changedRprims && incremental) {
+        for (const Ufe::Path& path : changedItems) {
+            if (selectedPaths.find(path) != selectedPaths.end()) {
+                appendFragmentRprims(path);
+            }
+        }
+    }
+
+    // Build the lead and active selections from the fragments.
+    _leadSelection.reset(new HdSelection);
+    _activeSelection.reset(new HdSelection);
+    for (const auto& item : items) {
+        const HdSelectionSharedPtr& selection
+            = (item->path() == leadPath) ? _leadSelection : _activeSelection;
+        for (const auto& rprimState : _selectionFragments[item->path()]) {
+            const SdfPath&                         rprim = rprimState.first;
+            const HdSelection::PrimSelectionState& state = rprimState.second;
+            if (state.fullySelected) {
+                selection->AddRprim(HdSelection::HighlightModeSelect, rprim);
+            }
+            for (const VtIntArray& instanceIndices : state.instanceIndices) {
+                selection->AddInstance(HdSelection::HighlightModeSelect, rprim, instanceIndices);
+            }
+        }
+    }
+
+    if (changedRprims) {
+        if (!incremental) {
+            AppendSelectedPrimPaths(_leadSelection, *changedRprims);
+            AppendSelectedPrimPaths(_activeSelection, *changedRprims);
+        }
+        std::sort(changedRprims->begin(), changedRprims->end());
+        changedRprims->erase(
+            std::unique(changedRprims->begin(), changedRprims->end()), changedRprims->end());
+    }
+
+    _leadSelectionPath = leadPath;
 #endif
 }
 
@@ -1857,16 +1991,8 @@ void ProxyRenderDelegate::_UpdateSelectionStates()
         dirtyPaths = &_renderIndex->GetRprimIds();
         _PopulateSelection();
     } else {
-        // Append pre-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
-
-        // Update lead and active selection.
-        _PopulateSelection();
-
-        // Append post-update lead and active selection.
-        AppendSelectedPrimPaths(_leadSelection, rootPaths);
-        AppendSelectedPrimPaths(_activeSelection, rootPaths);
+        // Update lead and active selection, collecting the rprims whose selection state changed.
+        _PopulateSelection(&rootPaths);
 
         dirtyPaths = &rootPaths;
     }
@@ -1896,6 +2022,15 @@ void ProxyRenderDelegate::_UpdateSelectionStates()
         _engine.Execute(_renderIndex.get(), &_dummyTasks);
         _taskController->SetCollection(*_defaultCollection);
     }
+
+#if defined(WANT_UFE_BUILD)
+    // Dirtying the selection highlight does not invalidate the selection fragments. They are
+    // not refreshed while the proxy shape is selected, so they stay stamped with an older scene
+    // state and are rebuilt by the next _PopulateSelection().
+    if (_displayStatus != MHWRender::kLead && _displayStatus != MHWRender::kActive) {
+        _selectionSceneStateVersion = _renderIndex->GetChangeTracker().GetSceneStateVersion();
+    }
+#endif
 }
 
 /*! \brief  Trigger rprim update for rprims whose visibility changed because of render tags change
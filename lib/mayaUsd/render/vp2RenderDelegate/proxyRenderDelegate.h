@@ -38,9 +38,13 @@
 #include <maya/MPxSubSceneOverride.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 #if defined(WANT_UFE_BUILD)
 #include <ufe/observer.h>
 #include <ufe/path.h>
+
+#include <unordered_map>
 #endif
 
 // Conditional compilation due to Maya API gap.
@@ -280,7 +284,7 @@ private:
     typedef std::pair<GfVec3f, std::atomic<uint64_t>> GfVec3fCache;
 
     bool   _isInitialized();
-    void   _PopulateSelection();
+    void   _PopulateSelection(SdfPathVector* changedRprims = nullptr);
     void   _UpdateSelectionStates();
     void   _UpdateRenderTags();
     void   _ClearRenderDelegate();
@@ -470,6 +474,15 @@ private:
     HdSelectionSharedPtr _activeSelection; //!< A collection of Rprims being active selection
 
 #if defined(WANT_UFE_BUILD)
+    //! The rprims, and their instances, selected by a single UFE scene item
+    using _SelectionFragment = std::vector<std::pair<SdfPath, HdSelection::PrimSelectionState>>;
+
+    //! Selection fragments of the selected UFE scene items under the proxy shape. They are kept
+    //! between selection changes, as long as the scene does not change.
+    std::unordered_map<Ufe::Path, _SelectionFragment> _selectionFragments;
+    Ufe::Path    _leadSelectionPath;                //!< The lead item, if under the proxy shape
+    unsigned int _selectionSceneStateVersion { 0 }; //!< Scene state of the selection fragments
+
     //! Observer to listen to UFE changes
     Ufe::Observer::Ptr _observer;
 #else
@@ -17,6 +17,7 @@
 
 #include "basisCurves.h"
 #include "bboxGeom.h"
+#include "debugCodes.h"
 #include "extComputation.h"
 #include "instancer.h"
 #include "material.h"
@@ -657,6 +658,20 @@ void HdVP2RenderDelegate::CommitResources(HdChangeTracker* tracker)
     //     3) Update any scene-level acceleration structures.
 
     _resourceRegistryVP2.Commit();
+
+    // All render items have been updated, buffers released during this frame can be reused.
+    _bufferPool.EndFrame();
+
+    if (TfDebug::IsEnabled(HDVP2_DEBUG_COMMIT)) {
+        const HdVP2BufferPoolStats stats = _bufferPool.GetStats();
+        TfDebug::Helper().Msg(
+            "HdVP2BufferPool: %zu buffers, %zu bytes pooled (high-water mark %zu bytes), "
+            "hit rate %.1f%%\n",
+            stats._pooledBufferCount,
+            stats._pooledBytes,
+            stats._highWaterMarkBytes,
+            stats.HitRate() * 100.0);
+    }
 }
 
 /*! \brief  Return a list of which Rprim types can be created by this class's.
@@ -694,6 +709,14 @@ HdVP2ResourceRegistry& HdVP2RenderDelegate::GetVP2ResourceRegistry()
     return _resourceRegistryVP2;
 }
 
+/*! \brief  Return VP2 buffer pool, recycling vertex and index buffers across frames.
+ */
+HdVP2BufferPool& HdVP2RenderDelegate::GetVP2BufferPool() { return _bufferPool; }
+
+/*! \brief  Return the cache of mesh rendering topologies, keyed by scene topology.
+ */
+HdVP2MeshTopologyCache& HdVP2RenderDelegate::GetMeshTopologyCache() { return _meshTopologyCache; }
+
 /*! \brief  Create a renderpass for rendering a given collection.
  */
 HdRenderPassSharedPtr
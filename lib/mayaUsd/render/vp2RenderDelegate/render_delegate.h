@@ -16,6 +16,8 @@
 #ifndef HD_VP2_RENDER_DELEGATE
 #define HD_VP2_RENDER_DELEGATE
 
+#include "buffer_pool.h"
+#include "meshTopologyCache.h"
 #include "render_param.h"
 #include "resource_registry.h"
 #include "shader.h"
@@ -85,7 +87,9 @@ public:
 
     HdResourceRegistrySharedPtr GetResourceRegistry() const override;
 
-    HdVP2ResourceRegistry& GetVP2ResourceRegistry();
+    HdVP2ResourceRegistry&  GetVP2ResourceRegistry();
+    HdVP2BufferPool&        GetVP2BufferPool();
+    HdVP2MeshTopologyCache& GetMeshTopologyCache();
 
     HdRenderPassSharedPtr
     CreateRenderPass(HdRenderIndex* index, HdRprimCollection const& collection) override;
@@ -184,6 +188,9 @@ private:
     SdfPath _id;          //!< Render delegate ID
     HdVP2ResourceRegistry
         _resourceRegistryVP2; //!< VP2 resource registry used for enqueue and execution of commits
+    HdVP2BufferPool _bufferPool; //!< Pool recycling vertex and index buffers released by Rprims
+    HdVP2MeshTopologyCache
+        _meshTopologyCache; //!< Rendering topologies shared by meshes with the same topology
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -25,6 +25,10 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 /*! \brief  Central place to manage GPU resources commits and any resources not managed by VP2
    directly \class  HdVP2ResourceRegistry
+
+    Commit tasks are executed serially on main-thread: they call VP2 APIs (buffer commits,
+    setShader, setGeometryForRenderItem, ...) which are not documented as thread-safe, and the
+    CPU-side data they upload is already prepared by the Rprims on the Sync worker threads.
 */
 class HdVP2ResourceRegistry
 {
@@ -57,4 +61,4 @@ private:
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
-#endif
\ No newline at end of file
+#endif
@@ -43,7 +43,11 @@ MayaUsdUndoBlock::~MayaUsdUndoBlock()
         UsdUfe::UsdUndoManagerAccessor::transferEdits(undoItem);
         MayaUsdUndoBlockCmd::execute(undoItem);
 
-        TF_DEBUG_MSG(USDUFE_UNDOSTACK, "Undoable Item adopted the new edits.\n");
+        TF_DEBUG_MSG(
+            USDUFE_UNDOSTACK,
+            "Undoable Item adopted %zu new edits holding %zu bytes.\n",
+            undoItem.size(),
+            undoItem.memoryUsage());
     }
 }
 
@@ -0,0 +1,742 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "stageRayIntersector.h"
+
+#include <pxr/base/gf/bbox3d.h>
+#include <pxr/base/gf/matrix4d.h>
+#include <pxr/base/gf/range3d.h>
+#include <pxr/base/gf/vec3i.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/usd/primRange.h>
+#include <pxr/usd/usdGeom/imageable.h>
+#include <pxr/usd/usdGeom/mesh.h>
+#include <pxr/usd/usdGeom/tokens.h>
+#include <pxr/usd/usdGeom/xformCache.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Bounding volume hierarchy over items given by their bounds. The nodes are stored depth first:
+// the left child of an inner node directly follows it.
+struct _BVH
+{
+    struct Node
+    {
+        GfRange3d bounds;
+        uint32_t  first { 0 }; //!< First item of a leaf, or right child of an inner node
+        uint32_t  count { 0 }; //!< Number of items of a leaf, zero for inner nodes
+    };
+
+    std::vector<Node>     nodes;
+    std::vector<uint32_t> items;
+
+    void Build(const std::vector<GfRange3d>& itemBounds)
+    {
+        nodes.clear();
+        items.resize(itemBounds.size());
+        if (itemBounds.empty()) {
+            return;
+        }
+
+        std::vector<GfVec3d> centroids(itemBounds.size());
+        for (size_t i = 0; i < itemBounds.size(); ++i) {
+            items[i] = static_cast<uint32_t>(i);
+            centroids[i] = itemBounds[i].GetMidpoint();
+        }
+
+        nodes.reserve(2 * itemBounds.size() / _maxLeafSize + 1);
+        _Build(itemBounds, centroids, 0, static_cast<uint32_t>(items.size()));
+    }
+
+    // Visits the items of the leaves whose bounds pass nodeTest. The test is done again for each
+    // node, so that it can be narrowed by the visited items.
+    template <typename NodeTest, typename ItemVisitor>
+    void Traverse(const NodeTest& nodeTest, const ItemVisitor& visitItem) const
+    {
+        if (nodes.empty()) {
+            return;
+        }
+
+        // Median splits keep the depth, and so the stack, logarithmic in the number of items.
+        uint32_t stack[64];
+        int      stackSize = 0;
+        stack[stackSize++] = 0;
+        while (stackSize > 0) {
+            const uint32_t nodeIndex = stack[--stackSize];
+            const Node&    node = nodes[nodeIndex];
+            if (!nodeTest(node.bounds)) {
+                continue;
+            }
+
+            if (node.count > 0) {
+                for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                    visitItem(items[i]);
+                }
+            } else {
+                stack[stackSize++] = node.first;
+                stack[stackSize++] = nodeIndex + 1;
+            }
+        }
+    }
+
+private:
+    static constexpr uint32_t _maxLeafSize = 4;
+
+    uint32_t _Build(
+        const std::vector<GfRange3d>& itemBounds,
+        const std::vector<GfVec3d>&   centroids,
+        uint32_t                      begin,
+        uint32_t                      end)
+    {
+        const uint32_t nodeIndex = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+
+        GfRange3d bounds;
+        GfRange3d centroidBounds;
+        for (uint32_t i = begin; i < end; ++i) {
+            bounds.UnionWith(itemBounds[items[i]]);
+            centroidBounds.UnionWith(centroids[items[i]]);
+        }
+        nodes[nodeIndex].bounds = bounds;
+
+        const GfVec3d size = centroidBounds.GetSize();
+        const int     axis = (size[0] > size[1]) ? ((size[0] > size[2]) ? 0 : 2)
+                                                 : ((size[1] > size[2]) ? 1 : 2);
+        if (end - begin <= _maxLeafSize || size[axis] <= 0.0) {
+            nodes[nodeIndex].first = begin;
+            nodes[nodeIndex].count = end - begin;
+            return nodeIndex;
+        }
+
+        const uint32_t middle = begin + (end - begin) / 2;
+        std::nth_element(
+            items.begin() + begin,
+            items.begin() + middle,
+            items.begin() + end,
+            [&centroids, axis](uint32_t a, uint32_t b) {
+                return centroids[a][axis] < centroids[b][axis];
+            });
+
+        _Build(itemBounds, centroids, begin, middle);
+        const uint32_t right = _Build(itemBounds, centroids, middle, end);
+        nodes[nodeIndex].first = right;
+        nodes[nodeIndex].count = 0;
+        return nodeIndex;
+    }
+};
+
+bool _IntersectBox(
+    const GfRange3d& box,
+    const GfVec3d&   origin,
+    const GfVec3d&   invDirection,
+    double           maxDistance)
+{
+    double tMin = 0.0;
+    double tMax = maxDistance;
+    for (int axis = 0; axis < 3; ++axis) {
+        // A ray parallel to the slab of the axis only crosses the box from inside the slab. The
+        // slab distances would be NaN when the origin is on a side of the box.
+        if (std::isinf(invDirection[axis])) {
+            if (origin[axis] < box.GetMin()[axis] || origin[axis] > box.GetMax()[axis]) {
+                return false;
+            }
+            continue;
+        }
+
+        double tNear = (box.GetMin()[axis] - origin[axis]) * invDirection[axis];
+        double tFar = (box.GetMax()[axis] - origin[axis]) * invDirection[axis];
+        if (tNear > tFar) {
+            std::swap(tNear, tFar);
+        }
+        tMin = std::max(tMin, tNear);
+        tMax = std::min(tMax, tFar);
+        if (tMin > tMax) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Moller-Trumbore ray-triangle intersection.
+bool _IntersectTriangle(
+    const GfVec3d& origin,
+    const GfVec3d& direction,
+    const GfVec3d& p0,
+    const GfVec3d& p1,
+    const GfVec3d& p2,
+    double*        distance)
+{
+    const GfVec3d edge1 = p1 - p0;
+    const GfVec3d edge2 = p2 - p0;
+    const GfVec3d pVec = GfCross(direction, edge2);
+    const double  det = GfDot(edge1, pVec);
+    if (det == 0.0) {
+        return false;
+    }
+
+    const double  invDet = 1.0 / det;
+    const GfVec3d tVec = origin - p0;
+    const double  u = GfDot(tVec, pVec) * invDet;
+    if (u < 0.0 || u > 1.0) {
+        return false;
+    }
+
+    const GfVec3d qVec = GfCross(tVec, edge1);
+    const double  v = GfDot(direction, qVec) * invDet;
+    if (v < 0.0 || u + v > 1.0) {
+        return false;
+    }
+
+    const double t = GfDot(edge2, qVec) * invDet;
+    if (t < 0.0 || t >= *distance) {
+        return false;
+    }
+
+    *distance = t;
+    return true;
+}
+
+// Closest point on a triangle, from Real-Time Collision Detection (Ericson).
+GfVec3d _ClosestPointOnTriangle(
+    const GfVec3d& point,
+    const GfVec3d& a,
+    const GfVec3d& b,
+    const GfVec3d& c)
+{
+    const GfVec3d ab = b - a;
+    const GfVec3d ac = c - a;
+    const GfVec3d ap = point - a;
+    const double  d1 = GfDot(ab, ap);
+    const double  d2 = GfDot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        return a;
+    }
+
+    const GfVec3d bp = point - b;
+    const double  d3 = GfDot(ab, bp);
+    const double  d4 = GfDot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3) {
+        return b;
+    }
+
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        return a + ab * (d1 / (d1 - d3));
+    }
+
+    const GfVec3d cp = point - c;
+    const double  d5 = GfDot(ab, cp);
+    const double  d6 = GfDot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6) {
+        return c;
+    }
+
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        return a + ac * (d2 / (d2 - d6));
+    }
+
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    const double denom = 1.0 / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+double _DistanceSquaredToBox(const GfVec3d& point, const GfRange3d& box)
+{
+    double distanceSq = 0.0;
+    for (int axis = 0; axis < 3; ++axis) {
+        const double below = box.GetMin()[axis] - point[axis];
+        const double above = point[axis] - box.GetMax()[axis];
+        const double delta = std::max(0.0, std::max(below, above));
+        distanceSq += delta * delta;
+    }
+    return distanceSq;
+}
+
+} // namespace
+
+struct UsdMayaStageRayIntersector::_MeshBVH
+{
+    VtVec3fArray         points;
+    std::vector<GfVec3i> triangles;
+    _BVH                 bvh;
+    bool                 leftHanded { false };
+
+    GfVec3d Point(int index) const { return GfVec3d(points[index]); }
+
+    // Geometric normal, following the orientation of the mesh.
+    GfVec3d Normal(const GfVec3i& triangle) const
+    {
+        const GfVec3d p0 = Point(triangle[0]);
+        const GfVec3d normal = GfCross(Point(triangle[1]) - p0, Point(triangle[2]) - p0);
+        return leftHanded ? -normal : normal;
+    }
+};
+
+struct UsdMayaStageRayIntersector::_Scene
+{
+    struct Instance
+    {
+        SdfPath                         path;
+        GfMatrix4d                      toRoot;
+        GfMatrix4d                      fromRoot;
+        std::shared_ptr<const _MeshBVH> mesh;
+    };
+
+    std::vector<Instance> instances;
+    _BVH                  bvh;
+
+    GfVec3d NormalToRoot(const Instance& instance, const GfVec3d& normal) const
+    {
+        // Normals are transformed by the inverse transpose.
+        return instance.fromRoot.GetTranspose().TransformDir(normal).GetNormalized();
+    }
+};
+
+UsdMayaStageRayIntersector::UsdMayaStageRayIntersector(size_t maxCachedTimes)
+    : _maxCachedTimes(std::max<size_t>(maxCachedTimes, 1))
+{
+}
+
+UsdMayaStageRayIntersector::~UsdMayaStageRayIntersector() = default;
+
+void UsdMayaStageRayIntersector::Clear()
+{
+    _meshBVHs.clear();
+    _scenes.clear();
+    _sceneTimes.clear();
+    _stage = UsdStageWeakPtr();
+    _rootPath = SdfPath();
+    _purposes.clear();
+}
+
+void UsdMayaStageRayIntersector::SetExcludePrimPaths(const SdfPathVector& excludePrimPaths)
+{
+    SdfPathVector sortedPaths = excludePrimPaths;
+    std::sort(sortedPaths.begin(), sortedPaths.end());
+    sortedPaths.erase(std::unique(sortedPaths.begin(), sortedPaths.end()), sortedPaths.end());
+    if (sortedPaths == _excludePrimPaths) {
+        return;
+    }
+
+    // The mesh hierarchies do not depend on the excluded paths, only the scenes do.
+    _excludePrimPaths = std::move(sortedPaths);
+    _scenes.clear();
+    _sceneTimes.clear();
+}
+
+void UsdMayaStageRayIntersector::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    TRACE_FUNCTION();
+
+    // Any change can move meshes around, but the mesh hierarchies only need to be rebuilt for
+    // the changed prims. A resync can also change which prototype the instances use.
+    bool changed = false;
+    bool resynced = false;
+
+    auto invalidatePrim = [this](const SdfPath& primPath, bool descendants) {
+        auto it = _meshBVHs.lower_bound(primPath);
+        while (it != _meshBVHs.end() && it->first.HasPrefix(primPath)) {
+            if (descendants || it->first == primPath) {
+                it = _meshBVHs.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    };
+
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        invalidatePrim(path.GetPrimPath(), true);
+        changed = true;
+        resynced = true;
+    }
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        invalidatePrim(path.GetPrimPath(), false);
+        changed = true;
+    }
+
+    if (resynced) {
+        for (auto it = _meshBVHs.begin(); it != _meshBVHs.end();) {
+            if (UsdPrim::IsPathInPrototype(it->first)) {
+                it = _meshBVHs.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    if (changed) {
+        _scenes.clear();
+        _sceneTimes.clear();
+    }
+}
+
+std::shared_ptr<const UsdMayaStageRayIntersector::_MeshBVH>
+UsdMayaStageRayIntersector::_GetMeshBVH(const UsdPrim& prim, const UsdTimeCode& time)
+{
+    // All the instances of a prototype share its hierarchies.
+    const UsdPrim     sourcePrim = prim.IsInstanceProxy() ? prim.GetPrimInPrototype() : prim;
+    const UsdGeomMesh mesh(sourcePrim);
+
+    const UsdAttribute pointsAttr = mesh.GetPointsAttr();
+    const UsdAttribute countsAttr = mesh.GetFaceVertexCountsAttr();
+    const UsdAttribute indicesAttr = mesh.GetFaceVertexIndicesAttr();
+    const bool         isVarying = pointsAttr.ValueMightBeTimeVarying()
+        || countsAttr.ValueMightBeTimeVarying() || indicesAttr.ValueMightBeTimeVarying();
+
+    std::shared_ptr<const _MeshBVH>& cached
+        = _meshBVHs[sourcePrim.GetPath()][isVarying ? time : UsdTimeCode::Default()];
+    if (cached) {
+        return cached;
+    }
+
+    TRACE_FUNCTION();
+
+    auto       meshBVH = std::make_shared<_MeshBVH>();
+    VtIntArray counts;
+    VtIntArray indices;
+    TfToken    orientation;
+    if (pointsAttr.Get(&meshBVH->points, time) && countsAttr.Get(&counts, time)
+        && indicesAttr.Get(&indices, time)) {
+        meshBVH->leftHanded = mesh.GetOrientationAttr().Get(&orientation, time)
+            && orientation == UsdGeomTokens->leftHanded;
+
+        // Fan triangulation, skipping the faces with invalid indices.
+        const int numPoints = static_cast<int>(meshBVH->points.size());
+        size_t    faceStart = 0;
+        for (const int count : counts) {
+            if (count < 0 || faceStart + count > indices.size()) {
+                break;
+            }
+
+            for (int i = 1; i + 1 < count; ++i) {
+                const GfVec3i triangle(
+                    indices[faceStart], indices[faceStart + i], indices[faceStart + i + 1]);
+                if (triangle[0] >= 0 && triangle[0] < numPoints && triangle[1] >= 0
+                    && triangle[1] < numPoints && triangle[2] >= 0 && triangle[2] < numPoints) {
+                    meshBVH->triangles.push_back(triangle);
+                }
+            }
+            faceStart += count;
+        }
+    }
+
+    std::vector<GfRange3d> triangleBounds(meshBVH->triangles.size());
+    for (size_t i = 0; i < meshBVH->triangles.size(); ++i) {
+        const GfVec3i& triangle = meshBVH->triangles[i];
+        GfRange3d&     bounds = triangleBounds[i];
+        bounds.UnionWith(meshBVH->Point(triangle[0]));
+        bounds.UnionWith(meshBVH->Point(triangle[1]));
+        bounds.UnionWith(meshBVH->Point(triangle[2]));
+    }
+    meshBVH->bvh.Build(triangleBounds);
+
+    cached = meshBVH;
+    return cached;
+}
+
+const UsdMayaStageRayIntersector::_Scene& UsdMayaStageRayIntersector::_GetScene(
+    const UsdPrim&       root,
+    const UsdTimeCode&   time,
+    const TfTokenVector& purposes)
+{
+    if (root.GetStage() != _stage || root.GetPath() != _rootPath || purposes != _purposes) {
+        Clear();
+        _stage = root.GetStage();
+        _rootPath = root.GetPath();
+        _purposes = purposes;
+    }
+
+    auto found = _scenes.find(time);
+    if (found != _scenes.end()) {
+        return *found->second;
+    }
+
+    TRACE_FUNCTION();
+
+    // Release the oldest scene, along with the hierarchies of the meshes varying at its time.
+    while (_scenes.size() >= _maxCachedTimes) {
+        const UsdTimeCode oldestTime = _sceneTimes.front();
+        _sceneTimes.pop_front();
+        _scenes.erase(oldestTime);
+        if (!oldestTime.IsDefault()) {
+            for (auto& meshBVHs : _meshBVHs) {
+                meshBVHs.second.erase(oldestTime);
+            }
+        }
+    }
+
+    std::unique_ptr<_Scene> scene(new _Scene());
+
+    const UsdGeomImageable rootImageable(root);
+    TfToken                visibility;
+    if (!rootImageable || rootImageable.ComputeVisibility(time) != UsdGeomTokens->invisible) {
+        UsdGeomXformCache xformCache(time);
+        UsdPrimRange      range(root, UsdTraverseInstanceProxies());
+        for (auto it = range.begin(); it != range.end(); ++it) {
+            if (std::binary_search(
+                    _excludePrimPaths.begin(), _excludePrimPaths.end(), it->GetPath())) {
+                it.PruneChildren();
+                continue;
+            }
+
+            const UsdGeomImageable imageable(*it);
+            if (imageable && imageable.GetVisibilityAttr().Get(&visibility, time)
+                && visibility == UsdGeomTokens->invisible) {
+                it.PruneChildren();
+                continue;
+            }
+
+            if (!it->IsA<UsdGeomMesh>()) {
+                continue;
+            }
+
+            if (std::find(purposes.begin(), purposes.end(), imageable.ComputePurpose())
+                == purposes.end()) {
+                continue;
+            }
+
+            std::shared_ptr<const _MeshBVH> meshBVH = _GetMeshBVH(*it, time);
+            if (meshBVH->triangles.empty()) {
+                continue;
+            }
+
+            _Scene::Instance instance;
+            instance.path = it->GetPath();
+            instance.mesh = meshBVH;
+            if (*it != root) {
+                bool resetXformStack = false;
+                instance.toRoot = xformCache.ComputeRelativeTransform(*it, root, &resetXformStack);
+            } else {
+                instance.toRoot.SetIdentity();
+            }
+            instance.fromRoot = instance.toRoot.GetInverse();
+            scene->instances.push_back(std::move(instance));
+        }
+    }
+
+    std::vector<GfRange3d> instanceBounds(scene->instances.size());
+    for (size_t i = 0; i < scene->instances.size(); ++i) {
+        const _Scene::Instance& instance = scene->instances[i];
+        instanceBounds[i]
+            = GfBBox3d(instance.mesh->bvh.nodes[0].bounds, instance.toRoot).ComputeAlignedRange();
+    }
+    scene->bvh.Build(instanceBounds);
+
+    _sceneTimes.push_back(time);
+    return *_scenes.emplace(time, std::move(scene)).first->second;
+}
+
+/* static */
+bool UsdMayaStageRayIntersector::_IntersectRay(const _Scene& scene, const GfRay& ray, Hit* hit)
+{
+    // The ray parameter is kept when transforming the ray to the space of a mesh, so that the
+    // hits in all the meshes can be compared.
+    const GfVec3d& origin = ray.GetStartPoint();
+    const GfVec3d& direction = ray.GetDirection();
+    const GfVec3d  invDirection(1.0 / direction[0], 1.0 / direction[1], 1.0 / direction[2]);
+
+    double                  closest = std::numeric_limits<double>::max();
+    const _Scene::Instance* hitInstance = nullptr;
+    const GfVec3i*          hitTriangle = nullptr;
+
+    scene.bvh.Traverse(
+        [&](const GfRange3d& bounds) {
+            return _IntersectBox(bounds, origin, invDirection, closest);
+        },
+        [&](uint32_t instanceIndex) {
+            const _Scene::Instance& instance = scene.instances[instanceIndex];
+            const _MeshBVH&         mesh = *instance.mesh;
+
+            GfRay localRay(ray);
+            localRay.Transform(instance.fromRoot);
+            const GfVec3d& localOrigin = localRay.GetStartPoint();
+            const GfVec3d& localDirection = localRay.GetDirection();
+            const GfVec3d  localInvDirection(
+                1.0 / localDirection[0], 1.0 / localDirection[1], 1.0 / localDirection[2]);
+
+            mesh.bvh.Traverse(
+                [&](const GfRange3d& bounds) {
+                    return _IntersectBox(bounds, localOrigin, localInvDirection, closest);
+                },
+                [&](uint32_t triangleIndex) {
+                    const GfVec3i& triangle = mesh.triangles[triangleIndex];
+                    if (_IntersectTriangle(
+                            localOrigin,
+                            localDirection,
+                            mesh.Point(triangle[0]),
+                            mesh.Point(triangle[1]),
+                            mesh.Point(triangle[2]),
+                            &closest)) {
+                        hitInstance = &instance;
+                        hitTriangle = &triangle;
+                    }
+                });
+        });
+
+    if (!hitInstance) {
+        return false;
+    }
+
+    hit->primPath = hitInstance->path;
+    hit->point = ray.GetPoint(closest);
+    hit->normal = scene.NormalToRoot(*hitInstance, hitInstance->mesh->Normal(*hitTriangle));
+    if (GfDot(hit->normal, direction) > 0.0) {
+        hit->normal = -hit->normal;
+    }
+    hit->distance = closest * direction.GetLength();
+    return true;
+}
+
+/* static */
+bool UsdMayaStageRayIntersector::_FindClosestPoint(
+    const _Scene&  scene,
+    const GfVec3d& point,
+    double         maxDistance,
+    Hit*           hit)
+{
+    // Distances are not kept when transforming to the space of a scaled mesh, so the search is
+    // done in the space of the root.
+    double closestSq = std::numeric_limits<double>::max();
+    if (maxDistance < std::sqrt(closestSq)) {
+        closestSq = maxDistance * maxDistance;
+    }
+
+    GfVec3d                 closestPoint;
+    const _Scene::Instance* hitInstance = nullptr;
+    const GfVec3i*          hitTriangle = nullptr;
+
+    scene.bvh.Traverse(
+        [&](const GfRange3d& bounds) { return _DistanceSquaredToBox(point, bounds) <= closestSq; },
+        [&](uint32_t instanceIndex) {
+            const _Scene::Instance& instance = scene.instances[instanceIndex];
+            const _MeshBVH&         mesh = *instance.mesh;
+
+            mesh.bvh.Traverse(
+                [&](const GfRange3d& bounds) {
+                    const GfRange3d rootBounds
+                        = GfBBox3d(bounds, instance.toRoot).ComputeAlignedRange();
+                    return _DistanceSquaredToBox(point, rootBounds) <= closestSq;
+                },
+                [&](uint32_t triangleIndex) {
+                    const GfVec3i& triangle = mesh.triangles[triangleIndex];
+                    const GfVec3d  candidate = _ClosestPointOnTriangle(
+                        point,
+                        instance.toRoot.Transform(mesh.Point(triangle[0])),
+                        instance.toRoot.Transform(mesh.Point(triangle[1])),
+                        instance.toRoot.Transform(mesh.Point(triangle[2])));
+                    const double distanceSq = (candidate - point).GetLengthSq();
+                    if (distanceSq < closestSq) {
+                        closestSq = distanceSq;
+                        closestPoint = candidate;
+                        hitInstance = &instance;
+                        hitTriangle = &triangle;
+                    }
+                });
+        });
+
+    if (!hitInstance) {
+        return false;
+    }
+
+    hit->primPath = hitInstance->path;
+    hit->point = closestPoint;
+    hit->normal = scene.NormalToRoot(*hitInstance, hitInstance->mesh->Normal(*hitTriangle));
+    hit->distance = std::sqrt(closestSq);
+    return true;
+}
+
+bool UsdMayaStageRayIntersector::IntersectRay(
+    const UsdPrim&       root,
+    const UsdTimeCode&   time,
+    const TfTokenVector& purposes,
+    const GfRay&         ray,
+    Hit*                 hit)
+{
+    TRACE_FUNCTION();
+
+    if (!root || !hit) {
+        return false;
+    }
+
+    return _IntersectRay(_GetScene(root, time, purposes), ray, hit);
+}
+
+size_t UsdMayaStageRayIntersector::IntersectRays(
+    const UsdPrim&            root,
+    const UsdTimeCode&        time,
+    const TfTokenVector&      purposes,
+    const std::vector<GfRay>& rays,
+    std::vector<Hit>*         hits)
+{
+    TRACE_FUNCTION();
+
+    if (!hits) {
+        return 0;
+    }
+
+    hits->assign(rays.size(), Hit());
+    if (!root) {
+        return 0;
+    }
+
+    // The scene and its mesh hierarchies are only read by the queries.
+    const _Scene&       scene = _GetScene(root, time, purposes);
+    std::atomic<size_t> numHits { 0 };
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, rays.size()), [&](const auto& range) {
+        size_t rangeHits = 0;
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            if (_IntersectRay(scene, rays[i], &(*hits)[i])) {
+                ++rangeHits;
+            }
+        }
+        numHits += rangeHits;
+    });
+
+    return numHits;
+}
+
+bool UsdMayaStageRayIntersector::FindClosestPoint(
+    const UsdPrim&       root,
+    const UsdTimeCode&   time,
+    const TfTokenVector& purposes,
+    const GfVec3d&       point,
+    Hit*                 hit,
+    double               maxDistance)
+{
+    TRACE_FUNCTION();
+
+    if (!root || !hit) {
+        return false;
+    }
+
+    return _FindClosestPoint(_GetScene(root, time, purposes), point, maxDistance, hit);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
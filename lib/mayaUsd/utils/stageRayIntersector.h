@@ -0,0 +1,134 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_STAGE_RAY_INTERSECTOR_H
+#define PXRUSDMAYA_STAGE_RAY_INTERSECTOR_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/gf/ray.h>
+#include <pxr/base/gf/vec3d.h>
+#include <pxr/base/tf/token.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/prim.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <deque>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdMayaStageRayIntersector
+/// \brief CPU ray intersection and closest point queries against the meshes of a stage.
+///
+/// The meshes under a root prim are organized in a two-level bounding volume hierarchy: each
+/// mesh has a triangle hierarchy in its own space, and a top-level hierarchy is built over the
+/// mesh instances placed relative to the root prim. Both levels are built lazily on the first
+/// query. The top level is kept per time code, up to a maximum number of time codes, and the
+/// mesh hierarchies are shared between all the times for which the mesh points and topology
+/// are not time-varying, as well as between all the instances of a prototype.
+///
+/// Invisible meshes, meshes whose purpose is not one of the given purposes and the prims under
+/// the excluded prim paths are ignored.
+/// Subdivision surfaces are intersected as their control mesh. Queries and results are in the
+/// space of the root prim.
+class MAYAUSD_CORE_PUBLIC UsdMayaStageRayIntersector
+{
+public:
+    struct Hit
+    {
+        SdfPath primPath; //!< The hit mesh, or its instance proxy. Empty on a miss.
+        GfVec3d point;
+        GfVec3d normal; //!< Normalized
+        double  distance { std::numeric_limits<double>::max() };
+    };
+
+    UsdMayaStageRayIntersector(size_t maxCachedTimes = 4);
+    ~UsdMayaStageRayIntersector();
+
+    UsdMayaStageRayIntersector(const UsdMayaStageRayIntersector&) = delete;
+    UsdMayaStageRayIntersector& operator=(const UsdMayaStageRayIntersector&) = delete;
+
+    /// \brief Finds the first intersection of \p ray with the meshes under \p root. The normal
+    /// of the hit faces the ray origin.
+    bool IntersectRay(
+        const UsdPrim&       root,
+        const UsdTimeCode&   time,
+        const TfTokenVector& purposes,
+        const GfRay&         ray,
+        Hit*                 hit);
+
+    /// \brief Finds the first intersections of all the \p rays, in parallel. The hits of the
+    /// rays that miss have an empty prim path. Returns the number of rays that hit.
+    size_t IntersectRays(
+        const UsdPrim&            root,
+        const UsdTimeCode&        time,
+        const TfTokenVector&      purposes,
+        const std::vector<GfRay>& rays,
+        std::vector<Hit>*         hits);
+
+    /// \brief Finds the point of the meshes under \p root closest to \p point, up to
+    /// \p maxDistance away.
+    bool FindClosestPoint(
+        const UsdPrim&       root,
+        const UsdTimeCode&   time,
+        const TfTokenVector& purposes,
+        const GfVec3d&       point,
+        Hit*                 hit,
+        double               maxDistance = std::numeric_limits<double>::max());
+
+    /// \brief Sets the prims whose subtrees are ignored by the queries.
+    void SetExcludePrimPaths(const SdfPathVector& excludePrimPaths);
+
+    /// \brief Releases what is affected by the changes in \p notice.
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
+    /// \brief Clears everything but the excluded prim paths.
+    void Clear();
+
+private:
+    struct _MeshBVH;
+    struct _Scene;
+
+    const _Scene&
+    _GetScene(const UsdPrim& root, const UsdTimeCode& time, const TfTokenVector& purposes);
+    std::shared_ptr<const _MeshBVH> _GetMeshBVH(const UsdPrim& mesh, const UsdTimeCode& time);
+
+    static bool _IntersectRay(const _Scene& scene, const GfRay& ray, Hit* hit);
+    static bool
+    _FindClosestPoint(const _Scene& scene, const GfVec3d& point, double maxDistance, Hit* hit);
+
+    // The mesh hierarchies of a prim, per time code. Static meshes only have an entry for the
+    // default time code.
+    using _MeshBVHs = std::map<UsdTimeCode, std::shared_ptr<const _MeshBVH>>;
+
+    std::map<SdfPath, _MeshBVHs>                   _meshBVHs; //!< Keyed by the prototype prims
+    std::map<UsdTimeCode, std::unique_ptr<_Scene>> _scenes;
+    std::deque<UsdTimeCode>                        _sceneTimes; //!< Oldest first
+    UsdStageWeakPtr                                _stage;
+    SdfPath                                        _rootPath;
+    TfTokenVector                                  _purposes;
+    SdfPathVector                                  _excludePrimPaths; //!< Sorted
+    const size_t                                   _maxCachedTimes;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXRUSDMAYA_STAGE_RAY_INTERSECTOR_H
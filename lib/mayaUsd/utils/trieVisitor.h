@@ -22,19 +22,24 @@
 #include <ufe/trie.h>
 
 #include <functional>
+#include <memory>
 
 namespace MAYAUSD_NS_DEF {
 
 /// TrieVisitor allows visiting all nodes of a UFE Trie and receiving the full,
 /// correctly built UFE path of each node.
 ///
+/// The node type can be changed to visit other tries whose nodes have the same
+/// interface as the UFE trie nodes, in which case only the visit of a node is
+/// available.
+///
 /// Note: this cannot be moved to UsdUfe since it needs to know about Maya run-time
 ///       to build the UFE path segments with the correct run-time ID.
 
-template <class T> struct TrieVisitor
+template <class T, class Node = Ufe::TrieNode<T>> struct TrieVisitor
 {
-    using TrieVistorFunction = std::function<void(const Ufe::Path&, Ufe::TrieNode<T>& node)>;
-    using TrieNodePtr = typename Ufe::TrieNode<T>::Ptr;
+    using TrieVistorFunction = std::function<void(const Ufe::Path&, Node& node)>;
+    using TrieNodePtr = std::shared_ptr<Node>;
 
     /// \brief Visit each node of the \p trie, calling the given \p function.
     ///
@@ -59,15 +64,17 @@ template <class T> struct TrieVisitor
         bool                      allNodes = false);
 };
 
-template <class T>
-inline void
-TrieVisitor<T>::visit(const Ufe::Trie<T>& trie, const TrieVistorFunction& function, bool allNodes)
+template <class T, class Node>
+inline void TrieVisitor<T, Node>::visit(
+    const Ufe::Trie<T>&       trie,
+    const TrieVistorFunction& function,
+    bool                      allNodes)
 {
     visit(Ufe::Path(), trie.root(), function, allNodes);
 }
 
-template <class T>
-inline void TrieVisitor<T>::visit(
+template <class T, class Node>
+inline void TrieVisitor<T, Node>::visit(
     const Ufe::Path&          parentPath,
     const TrieNodePtr&        node,
     const TrieVistorFunction& function,
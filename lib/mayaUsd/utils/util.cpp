@@ -42,7 +42,6 @@
 #include <maya/MItDag.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MItDependencyNodes.h>
-#include <maya/MItMeshFaceVertex.h>
 #include <maya/MItMeshPolygon.h>
 #include <maya/MMatrix.h>
 #include <maya/MObject.h>
@@ -122,18 +121,6 @@ bool shouldAddToSet(const MDagPath& toAdd, const UsdMayaUtil::MDagPathSet& dagPa
 
     return true;
 }
-
-bool GetMayaExtent(const UsdPrim& prim, GfRange3d& range)
-{
-    if (prim.IsA<UsdGeomCamera>()) {
-        // UsdGeomCamera, not being a UsdGeomBoundable, doesn't provide any extent information.
-        // So let's add Maya camera dimensions here
-        range = GfRange3d(GfVec3d(-0.4f, -0.3f, -2.0f), GfVec3d(0.4f, 1.0f, 2.0f));
-        return true;
-    }
-
-    return false;
-}
 } // namespace
 
 double UsdMayaUtil::ConvertMDistanceUnitToUsdGeomLinearUnit(const MDistance::Unit mdistanceUnit)
@@ -1139,48 +1126,61 @@ void UsdMayaUtil::CompressFaceVaryingPrimvarIndices(
     VtIntArray vertexAssignments;
     vertexAssignments.assign((size_t)numVertices, -2);
 
-    // We assume that the data is constant/uniform/vertex until we can
-    // prove otherwise that two components have differing values.
-    bool isConstant = true;
-    bool isUniform = true;
-    bool isVertex = true;
-
-    MItMeshFaceVertex itFV(mesh.object());
-    unsigned int      fvi = 0;
-    for (itFV.reset(); !itFV.isDone(); itFV.next(), ++fvi) {
-        int faceIndex = itFV.faceId();
-        int vertexIndex = itFV.vertId();
+    // Fetch the face-vertex topology in one call instead of walking the mesh
+    // with MItMeshFaceVertex.
+    MIntArray faceVertexCounts;
+    MIntArray faceVertexIndices;
+    if (!mesh.getVertices(faceVertexCounts, faceVertexIndices)
+        || faceVertexIndices.length() != assignmentIndices->size()) {
+        return;
+    }
 
-        int assignedIndex = (*assignmentIndices)[fvi];
+    const VtIntArray& indices = *assignmentIndices;
+    const int*        assigned = indices.cdata();
+    const int*        vertexIds = &faceVertexIndices[0];
+    const size_t      numFaceVertices = indices.size();
 
-        if (isConstant) {
-            if (assignedIndex != (*assignmentIndices)[0]) {
-                isConstant = false;
-            }
+    // Each classification is a separate flat pass that stops at the first
+    // mismatch, which is usually found early for face-varying data.
+    bool isConstant = true;
+    for (size_t fvi = 1; fvi < numFaceVertices; ++fvi) {
+        if (assigned[fvi] != assigned[0]) {
+            isConstant = false;
+            break;
         }
+    }
 
-        if (isUniform) {
-            if (uniformAssignments[faceIndex] < -1) {
-                // No value for this face yet, so store one.
-                uniformAssignments[faceIndex] = assignedIndex;
-            } else if (assignedIndex != uniformAssignments[faceIndex]) {
-                isUniform = false;
+    bool isUniform = !isConstant;
+    if (isUniform) {
+        int*   uniform = uniformAssignments.data();
+        size_t fvi = 0;
+        for (int faceIndex = 0; isUniform && faceIndex < numPolygons; ++faceIndex) {
+            const int faceVertexCount = faceVertexCounts[faceIndex];
+            for (int i = 0; i < faceVertexCount; ++i, ++fvi) {
+                if (uniform[faceIndex] < -1) {
+                    // No value for this face yet, so store one.
+                    uniform[faceIndex] = assigned[fvi];
+                } else if (assigned[fvi] != uniform[faceIndex]) {
+                    isUniform = false;
+                    break;
+                }
             }
         }
+    }
 
-        if (isVertex) {
-            if (vertexAssignments[vertexIndex] < -1) {
+    bool isVertex = !isConstant && !isUniform;
+    if (isVertex) {
+        int* vertex = vertexAssignments.data();
+        for (size_t fvi = 0; fvi < numFaceVertices; ++fvi) {
+            const int vertexIndex = vertexIds[fvi];
+            if (vertex[vertexIndex] < -1) {
                 // No value for this vertex yet, so store one.
-                vertexAssignments[vertexIndex] = assignedIndex;
-            } else if (assignedIndex != vertexAssignments[vertexIndex]) {
+                vertex[vertexIndex] = assigned[fvi];
+            } else if (assigned[fvi] != vertex[vertexIndex]) {
                 isVertex = false;
+                break;
             }
         }
-
-        if (!isConstant && !isUniform && !isVertex) {
-            // No compression will be possible, so stop trying.
-            break;
-        }
     }
 
     if (isConstant) {
@@ -1807,7 +1807,8 @@ VtDictionary UsdMayaUtil::GetDictionaryFromArgDatabase(
     //     are false if omitted, true if present (simple flags).
     // 2 - strings: Just strings!
     // 3 - doubles: A simple double
-    // 4 - vectors (multi-use args): Try to mimic the way they're passed in the
+    // 4 - ints: A simple int
+    // 5 - vectors (multi-use args): Try to mimic the way they're passed in the
     //     Python command API. If single arg per flag, make it a vector of
     //     strings. Multi arg per flag, vector of vector of strings.
     VtDictionary args;
@@ -1834,6 +1835,10 @@ VtDictionary UsdMayaUtil::GetDictionaryFromArgDatabase(
             double val = 0.0;
             argData.getFlagArgument(key.c_str(), 0, val);
             args[key] = val;
+        } else if (guideValue.IsHolding<int>()) {
+            int val = 0;
+            argData.getFlagArgument(key.c_str(), 0, val);
+            args[key] = val;
         } else if (guideValue.IsHolding<std::vector<VtValue>>()) {
             unsigned int count = argData.numberOfFlagUses(entry.first.c_str());
             if (!TF_VERIFY(count > 0)) {
@@ -2516,6 +2521,18 @@ MString UsdMayaUtil::GetCurrentSceneFilePath()
     return currentSceneFilePath;
 }
 
+bool UsdMayaUtil::GetMayaExtent(const UsdPrim& prim, GfRange3d& range)
+{
+    if (prim.IsA<UsdGeomCamera>()) {
+        // UsdGeomCamera, not being a UsdGeomBoundable, doesn't provide any extent information.
+        // So let's add Maya camera dimensions here
+        range = GfRange3d(GfVec3d(-0.4f, -0.3f, -2.0f), GfVec3d(0.4f, 1.0f, 2.0f));
+        return true;
+    }
+
+    return false;
+}
+
 void UsdMayaUtil::AddMayaExtents(GfBBox3d& bbox, const UsdPrim& root, const UsdTimeCode time)
 {
     GfRange3d localExtents;
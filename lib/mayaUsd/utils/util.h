@@ -678,6 +678,12 @@ MString GetCurrentMayaWorkspacePath();
 MAYAUSD_CORE_PUBLIC
 MString GetCurrentSceneFilePath();
 
+/// Gets the Maya-specific local extent of \p prim, for prims that are not
+/// UsdGeomBoundable but are drawn by Maya, such as cameras.
+/// Returns false if the prim has no such extent.
+MAYAUSD_CORE_PUBLIC
+bool GetMayaExtent(const PXR_NS::UsdPrim& prim, PXR_NS::GfRange3d& range);
+
 /// Takes the supplied bounding box and adds to it Maya-specific extents
 /// that come from the nodes originating from the supplied root node
 MAYAUSD_CORE_PUBLIC
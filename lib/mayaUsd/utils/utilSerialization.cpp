@@ -233,6 +233,16 @@ USDUnsavedEditsOption serializeUsdEditsLocationOption()
     }
 } // namespace MAYAUSD_NS_DEF
 
+bool serializeUsdEditsAsBinaryOption()
+{
+    static const MString kSerializedUsdEditsBinary(
+        MayaUsdOptionVars->SerializedUsdEditsBinary.GetText());
+
+    // Default is to serialize the edits as text, which is readable in .ma files.
+    return MGlobal::optionVarExists(kSerializedUsdEditsBinary)
+        && MGlobal::optionVarIntValue(kSerializedUsdEditsBinary) != 0;
+}
+
 void setNewProxyPath(
     const MString&        proxyNodeName,
     const MString&        newRootLayerPath,
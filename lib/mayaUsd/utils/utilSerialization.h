@@ -64,6 +64,12 @@ enum USDUnsavedEditsOption
 MAYAUSD_CORE_PUBLIC
 USDUnsavedEditsOption serializeUsdEditsLocationOption();
 
+/*! \brief Queries the Maya optionVar that decides if the Usd edits saved to
+    the Maya file are serialized as compressed binary data instead of text.
+ */
+MAYAUSD_CORE_PUBLIC
+bool serializeUsdEditsAsBinaryOption();
+
 /*! \brief Utility function to update the file path attribute on the proxy shape
     when an anonymous root layer gets exported to disk. Also optionally updates
     the target layer if the anonymous layer was the target layer.
@@ -0,0 +1,200 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "vec3fArraySampleCache.h"
+
+#include <pxr/base/gf/math.h>
+#include <pxr/base/tf/weakPtr.h>
+#include <pxr/base/trace/trace.h>
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/usd/attribute.h>
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdMayaVec3fArraySampleCache::UsdMayaVec3fArraySampleCache(size_t capacity)
+    : _capacity(std::max<size_t>(capacity, 1))
+{
+}
+
+UsdMayaVec3fArraySampleCache::~UsdMayaVec3fArraySampleCache()
+{
+    TfNotice::Revoke(_objectsChangedKey);
+}
+
+bool UsdMayaVec3fArraySampleCache::SetAttribute(
+    const UsdStageRefPtr& stage,
+    const SdfPath&        attrPath)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (get_pointer(_stage) != get_pointer(stage) || _attrPath != attrPath) {
+        _Clear();
+        if (!stage) {
+            return false;
+        }
+        _stage = stage;
+        _attrPath = attrPath;
+        _objectsChangedKey = TfNotice::Register(
+            TfCreateWeakPtr(this), &UsdMayaVec3fArraySampleCache::_OnObjectsChanged, _stage);
+    }
+
+    if (!_resolved && stage) {
+        const UsdAttribute attr = stage->GetAttributeAtPath(attrPath);
+        _query = attr ? UsdAttributeQuery(attr) : UsdAttributeQuery();
+        _resolved = true;
+    }
+    return _query.IsValid();
+}
+
+bool UsdMayaVec3fArraySampleCache::ValueMightBeTimeVarying() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _query.ValueMightBeTimeVarying();
+}
+
+bool UsdMayaVec3fArraySampleCache::Get(const UsdTimeCode& time, VtVec3fArray* value)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_query.IsValid()) {
+        return false;
+    }
+
+    // Attributes that are not time varying have the same value at all times, so it is cached once.
+    const bool        timeVarying = _query.ValueMightBeTimeVarying();
+    const UsdTimeCode sampleTime = timeVarying ? time : UsdTimeCode::Default();
+
+    const double stride = (_lastTime.IsDefault() || time.IsDefault())
+        ? 0.0
+        : time.GetValue() - _lastTime.GetValue();
+    const bool sequential = timeVarying && stride != 0.0 && GfIsClose(stride, _lastStride, 1e-6);
+    _lastTime = time;
+    _lastStride = stride;
+
+    if (const _Sample* sample = _Find(sampleTime)) {
+        *value = sample->value;
+        return true;
+    }
+
+    if (!sequential) {
+        if (!_query.Get(value, time)) {
+            return false;
+        }
+        _Insert(sampleTime, *value);
+        return true;
+    }
+
+    TRACE_FUNCTION();
+
+    // Read the requested sample along with the upcoming ones that are not cached yet, keeping
+    // half of the buffer for the samples already read.
+    std::vector<_Sample> samples { { sampleTime, {} } };
+    for (size_t i = 1; i <= _capacity / 2; ++i) {
+        const UsdTimeCode upcoming(time.GetValue() + i * stride);
+        if (!_Find(upcoming)) {
+            samples.push_back({ upcoming, {} });
+        }
+    }
+
+    std::vector<char> read(samples.size(), false);
+    WorkParallelForN(samples.size(), [this, &samples, &read](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            read[i] = _query.Get(&samples[i].value, samples[i].time);
+        }
+    });
+
+    if (!read[0]) {
+        return false;
+    }
+    *value = samples[0].value;
+    for (size_t i = 0; i < samples.size(); ++i) {
+        if (read[i]) {
+            _Insert(samples[i].time, samples[i].value);
+        }
+    }
+    return true;
+}
+
+void UsdMayaVec3fArraySampleCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _Clear();
+}
+
+void UsdMayaVec3fArraySampleCache::_Clear()
+{
+    TfNotice::Revoke(_objectsChangedKey);
+    _query = UsdAttributeQuery();
+    _stage = UsdStageWeakPtr();
+    _attrPath = SdfPath();
+    _resolved = false;
+    _lastTime = UsdTimeCode::Default();
+    _lastStride = 0.0;
+    _ClearSamples();
+}
+
+const UsdMayaVec3fArraySampleCache::_Sample*
+UsdMayaVec3fArraySampleCache::_Find(const UsdTimeCode& time) const
+{
+    for (const _Sample& sample : _samples) {
+        if (sample.time == time) {
+            return &sample;
+        }
+    }
+    return nullptr;
+}
+
+void UsdMayaVec3fArraySampleCache::_Insert(const UsdTimeCode& time, const VtVec3fArray& value)
+{
+    if (_samples.size() < _capacity) {
+        _samples.push_back({ time, value });
+        return;
+    }
+    _samples[_nextSample] = { time, value };
+    _nextSample = (_nextSample + 1) % _capacity;
+}
+
+void UsdMayaVec3fArraySampleCache::_ClearSamples()
+{
+    _samples.clear();
+    _nextSample = 0;
+}
+
+void UsdMayaVec3fArraySampleCache::_OnObjectsChanged(
+    const UsdNotice::ObjectsChanged& notice,
+    const UsdStageWeakPtr&)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // A resync may change which attribute the path resolves to, so the query is resolved again.
+    for (const SdfPath& path : notice.GetResyncedPaths()) {
+        if (_attrPath.HasPrefix(path)) {
+            _query = UsdAttributeQuery();
+            _resolved = false;
+            _ClearSamples();
+            return;
+        }
+    }
+    for (const SdfPath& path : notice.GetChangedInfoOnlyPaths()) {
+        if (_attrPath.HasPrefix(path)) {
+            _ClearSamples();
+            return;
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
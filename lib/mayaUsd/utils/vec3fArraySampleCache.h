@@ -0,0 +1,102 @@
+//
+// Copyright 2024 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef PXRUSDMAYA_VEC3F_ARRAY_SAMPLE_CACHE_H
+#define PXRUSDMAYA_VEC3F_ARRAY_SAMPLE_CACHE_H
+
+#include <mayaUsd/base/api.h>
+
+#include <pxr/base/tf/notice.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/base/vt/types.h>
+#include <pxr/pxr.h>
+#include <pxr/usd/sdf/path.h>
+#include <pxr/usd/usd/attributeQuery.h>
+#include <pxr/usd/usd/notice.h>
+#include <pxr/usd/usd/stage.h>
+#include <pxr/usd/usd/timeCode.h>
+
+#include <mutex>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdMayaVec3fArraySampleCache
+/// \brief Caches the recent time samples of a point or normal attribute, for the nodes that read
+/// it at every evaluation.
+///
+/// The attribute query is kept across evaluations, and only resolved again when the stage, the
+/// attribute path or the composition of the attribute changes. The values are kept in a ring
+/// buffer. When the requested times advance by a constant stride, as during playback in either
+/// direction, a miss also reads the upcoming samples along that stride, in parallel. The samples
+/// are dropped when the attribute is edited.
+///
+/// Change notices can be sent from another thread than the one computing the node, so all the
+/// cached state is guarded by a mutex.
+class MAYAUSD_CORE_PUBLIC UsdMayaVec3fArraySampleCache : public TfWeakBase
+{
+public:
+    UsdMayaVec3fArraySampleCache(size_t capacity = 16);
+    ~UsdMayaVec3fArraySampleCache();
+
+    UsdMayaVec3fArraySampleCache(const UsdMayaVec3fArraySampleCache&) = delete;
+    UsdMayaVec3fArraySampleCache& operator=(const UsdMayaVec3fArraySampleCache&) = delete;
+
+    /// \brief Targets the attribute at \p attrPath on \p stage. Returns false if there is no such
+    /// attribute.
+    bool SetAttribute(const UsdStageRefPtr& stage, const SdfPath& attrPath);
+
+    /// \brief Returns true if the value of the targeted attribute might vary over time.
+    bool ValueMightBeTimeVarying() const;
+
+    /// \brief Gets the value of the targeted attribute at \p time.
+    bool Get(const UsdTimeCode& time, VtVec3fArray* value);
+
+    /// \brief Drops the targeted attribute and the cached samples.
+    void Clear();
+
+private:
+    struct _Sample
+    {
+        UsdTimeCode  time;
+        VtVec3fArray value;
+    };
+
+    const _Sample* _Find(const UsdTimeCode& time) const;
+    void           _Insert(const UsdTimeCode& time, const VtVec3fArray& value);
+    void           _ClearSamples();
+    void           _Clear();
+    void _OnObjectsChanged(const UsdNotice::ObjectsChanged& notice, const UsdStageWeakPtr& sender);
+
+    mutable std::mutex _mutex; //!< Guards all the members below
+
+    std::vector<_Sample> _samples;
+    size_t               _nextSample { 0 }; //!< The oldest sample, once the buffer is full
+    const size_t         _capacity;
+
+    UsdAttributeQuery _query;
+    UsdStageWeakPtr   _stage;
+    SdfPath           _attrPath;
+    bool              _resolved { false };
+    TfNotice::Key     _objectsChangedKey;
+
+    // The previous requested time, and the stride from the one before.
+    UsdTimeCode _lastTime { UsdTimeCode::Default() };
+    double      _lastStride { 0.0 };
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXRUSDMAYA_VEC3F_ARRAY_SAMPLE_CACHE_H
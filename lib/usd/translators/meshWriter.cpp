@@ -382,7 +382,8 @@ bool PxrUsdTranslators_MeshWriter::writeMeshAttrs(
                 GetDagPath(),
                 skelPath,
                 exportArgs.stripNamespaces,
-                _GetSparseValueWriter());
+                _GetSparseValueWriter(),
+                exportArgs.maxJointInfluences);
 
             if (!_skelInputMesh.isNull()) {
                 // Add all skel primvars to the exclude set.
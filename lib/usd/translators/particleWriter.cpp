@@ -31,6 +31,7 @@
 #include <pxr/usd/usdGeom/points.h>
 
 #include <maya/MAnimControl.h>
+#include <maya/MDGContext.h>
 #include <maya/MDoubleArray.h>
 #include <maya/MFnAttribute.h>
 #include <maya/MFnDependencyNode.h>
@@ -269,7 +270,10 @@ void PxrUsdTranslators_ParticleWriter::writeParams(
 
     const auto particleNode = GetMayaObject();
     if (particleNode.apiType() != MFn::kNParticle) {
-        auto currentTime = MAnimControl::currentTime();
+        // The frame may be evaluated through a context rather than by changing the current time.
+        const MDGContext& context = MDGContext::current();
+        const MTime       currentTime
+            = context.isNormal() ? MAnimControl::currentTime() : context.getTime();
         if (mInitialFrameDone) {
             particleSys.evaluateDynamics(currentTime, false);
             deformedParticleSys.evaluateDynamics(currentTime, false);
@@ -15,11 +15,59 @@
 //
 #include "DiffPrims.h"
 
+#include <pxr/base/work/loops.h>
+#include <pxr/usd/pcp/layerStack.h>
+#include <pxr/usd/pcp/node.h>
+#include <pxr/usd/usd/resolveInfo.h>
+
+#include <atomic>
+
 namespace MayaUsdUtils {
 
 using UsdAttribute = PXR_NS::UsdAttribute;
 using VtValue = PXR_NS::VtValue;
 using UsdTimeCode = PXR_NS::UsdTimeCode;
+using UsdResolveInfo = PXR_NS::UsdResolveInfo;
+using PcpNodeRef = PXR_NS::PcpNodeRef;
+
+namespace {
+
+// Verify if both attributes get their values from the same opinion: the same spec or the same
+// value clips, found at the same path in the same layer stack and with the same time offset.
+// Their values are then the same at all times, without having to read them.
+bool haveSameValueSource(const UsdAttribute& modified, const UsdAttribute& baseline)
+{
+    if (modified == baseline)
+        return true;
+
+    if (modified.GetName() != baseline.GetName())
+        return false;
+
+    const UsdResolveInfo modifiedInfo = modified.GetResolveInfo();
+    const UsdResolveInfo baselineInfo = baseline.GetResolveInfo();
+    if (modifiedInfo.GetSource() != baselineInfo.GetSource())
+        return false;
+
+    switch (modifiedInfo.GetSource()) {
+    case PXR_NS::UsdResolveInfoSourceDefault:
+    case PXR_NS::UsdResolveInfoSourceTimeSamples:
+    case PXR_NS::UsdResolveInfoSourceValueClips: break;
+    default: return false;
+    }
+
+    const PcpNodeRef modifiedNode = modifiedInfo.GetNode();
+    const PcpNodeRef baselineNode = baselineInfo.GetNode();
+    if (!modifiedNode || !baselineNode)
+        return false;
+
+    return modifiedNode.GetPath() == baselineNode.GetPath()
+        && modifiedNode.GetMapToRoot().GetTimeOffset()
+        == baselineNode.GetMapToRoot().GetTimeOffset()
+        && modifiedNode.GetLayerStack()->GetIdentifier()
+        == baselineNode.GetLayerStack()->GetIdentifier();
+}
+
+} // namespace
 
 DiffResult
 compareAttributes(const UsdAttribute& modified, const UsdAttribute& baseline, DiffResult* quickDiff)
@@ -30,6 +78,12 @@ compareAttributes(const UsdAttribute& modified, const UsdAttribute& baseline, Di
     //
     // Note that the UsdAttribute API to get value automatically interpolates values
     // where samples are missing when queried.
+    if (modified.IsValid() && baseline.IsValid() && haveSameValueSource(modified, baseline)) {
+        if (quickDiff)
+            *quickDiff = DiffResult::Same;
+        return DiffResult::Same;
+    }
+
     std::vector<double> times;
     if (!UsdAttribute::GetUnionedTimeSamples({ modified, baseline }, &times)) {
         if (quickDiff)
@@ -46,10 +100,28 @@ compareAttributes(const UsdAttribute& modified, const UsdAttribute& baseline, Di
         return result;
     }
 
+    // The samples are compared in parallel. For a quick result, the samples after the first one
+    // found to be different are skipped, but all the samples before it are still compared, so the
+    // first difference in time is returned, as when comparing them in order.
+    std::vector<DiffResult> sampleResults(times.size(), DiffResult::Same);
+    std::atomic<size_t>     firstDifference(times.size());
+    PXR_NS::WorkParallelForN(times.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (quickDiff && i > firstDifference)
+                return;
+
+            sampleResults[i] = compareAttributes(modified, baseline, UsdTimeCode(times[i]));
+            if (quickDiff && sampleResults[i] != DiffResult::Same) {
+                size_t first = firstDifference;
+                while (i < first && !firstDifference.compare_exchange_weak(first, i)) { }
+                return;
+            }
+        }
+    });
+
     // The algorithm returns the common result if there is one. Stop as soon as we reach Differ.
     DiffResult overallResult = DiffResult::Same;
-    for (const double time : times) {
-        const DiffResult sampleResult = compareAttributes(modified, baseline, UsdTimeCode(time));
+    for (const DiffResult sampleResult : sampleResults) {
         if (sampleResult == DiffResult::Same) {
             continue;
         }
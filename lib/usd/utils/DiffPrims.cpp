@@ -15,7 +15,12 @@
 //
 #include "DiffPrims.h"
 
+#include <pxr/base/work/loops.h>
+
+#include <atomic>
+#include <limits>
 #include <map>
+#include <vector>
 
 namespace MayaUsdUtils {
 
@@ -33,6 +38,37 @@ using UsdRelationship = PXR_NS::UsdRelationship;
         }                                              \
     } while (false)
 
+namespace {
+
+// The attributes and children of a prim are compared in parallel, then the results are gathered
+// in order. For a quick result, the items after the first one found to be different are skipped,
+// but all the items before it are still compared, so the gathered results are the same as when
+// comparing them in order.
+void lowerFirstDifference(std::atomic<size_t>& firstDifference, size_t index)
+{
+    size_t first = firstDifference;
+    while (index < first && !firstDifference.compare_exchange_weak(first, index)) { }
+}
+
+struct AttributeDiff
+{
+    size_t       index;
+    UsdAttribute modified;
+    UsdAttribute baseline;
+    DiffResult   result;
+};
+
+struct ChildDiff
+{
+    size_t     index;
+    UsdPrim    modified;
+    UsdPrim    baseline;
+    DiffResult result;
+    DiffResult quickResult;
+};
+
+} // namespace
+
 DiffResultPerToken
 comparePrimsAttributes(const UsdPrim& modified, const UsdPrim& baseline, DiffResult* quickDiff)
 {
@@ -53,19 +89,35 @@ comparePrimsAttributes(const UsdPrim& modified, const UsdPrim& baseline, DiffRes
     // Compare the attributes from the modified prim.
     // Baseline attributes map won't change from now on, so cache the end.
     {
-        const auto baselineEnd = baselineAttrs.end();
+        std::vector<AttributeDiff> diffs;
+        std::atomic<size_t>        firstDifference(std::numeric_limits<size_t>::max());
+        const auto                 baselineEnd = baselineAttrs.end();
         for (const UsdAttribute& attr : modified.GetAuthoredAttributes()) {
-            const TfToken& name = attr.GetName();
-            const auto     iter = baselineAttrs.find(name);
+            const auto iter = baselineAttrs.find(attr.GetName());
             if (iter == baselineEnd) {
-                USD_MAYA_RETURN_QUICK_RESULT(DiffResult::Created, results);
-                results[name] = DiffResult::Created;
+                if (quickDiff)
+                    lowerFirstDifference(firstDifference, diffs.size());
+                diffs.push_back({ diffs.size(), attr, UsdAttribute(), DiffResult::Created });
             } else {
-                const DiffResult result = compareAttributes(attr, iter->second, quickDiff);
-                USD_MAYA_RETURN_QUICK_RESULT(result, results);
-                results[name] = result;
+                diffs.push_back({ diffs.size(), attr, iter->second, DiffResult::Same });
             }
         }
+
+        PXR_NS::WorkParallelForEach(diffs.begin(), diffs.end(), [&](AttributeDiff& diff) {
+            if (!diff.baseline || (quickDiff && diff.index > firstDifference))
+                return;
+
+            DiffResult attrQuickDiff = DiffResult::Same;
+            diff.result = compareAttributes(
+                diff.modified, diff.baseline, quickDiff ? &attrQuickDiff : nullptr);
+            if (quickDiff && diff.result != DiffResult::Same)
+                lowerFirstDifference(firstDifference, diff.index);
+        });
+
+        for (const AttributeDiff& diff : diffs) {
+            USD_MAYA_RETURN_QUICK_RESULT(diff.result, results);
+            results[diff.modified.GetName()] = diff.result;
+        }
     }
 
     // Identify attributes that are absent in the modified prim.
@@ -146,18 +198,40 @@ comparePrimsChildren(const UsdPrim& modified, const UsdPrim& baseline, DiffResul
     // Compare the children from the modified prim.
     // Baseline children map won't change from now on, so cache the end.
     {
-        const auto baselineEnd = baselineChildren.end();
+        std::vector<ChildDiff> diffs;
+        std::atomic<size_t>    firstDifference(std::numeric_limits<size_t>::max());
+        const auto             baselineEnd = baselineChildren.end();
         for (const UsdPrim& child : modified.GetAllChildren()) {
-            const SdfPath& path = child.GetPath();
-            const auto     iter = baselineChildren.find(path);
+            const auto iter = baselineChildren.find(child.GetPath());
             if (iter == baselineEnd) {
-                USD_MAYA_RETURN_QUICK_RESULT(DiffResult::Created, results);
-                results[path] = DiffResult::Created;
+                if (quickDiff)
+                    lowerFirstDifference(firstDifference, diffs.size());
+                diffs.push_back(
+                    { diffs.size(), child, UsdPrim(), DiffResult::Created, DiffResult::Created });
             } else {
-                results[path] = comparePrims(child, iter->second, quickDiff);
-                USD_MAYA_RETURN_QUICK_RESULT(*quickDiff, results);
+                diffs.push_back(
+                    { diffs.size(), child, iter->second, DiffResult::Same, DiffResult::Same });
             }
         }
+
+        PXR_NS::WorkParallelForEach(diffs.begin(), diffs.end(), [&](ChildDiff& diff) {
+            if (!diff.baseline || (quickDiff && diff.index > firstDifference))
+                return;
+
+            diff.result = comparePrims(
+                diff.modified, diff.baseline, quickDiff ? &diff.quickResult : nullptr);
+            if (quickDiff && diff.quickResult != DiffResult::Same)
+                lowerFirstDifference(firstDifference, diff.index);
+        });
+
+        // Note: unlike created children, children that differ are part of the quick results.
+        for (const ChildDiff& diff : diffs) {
+            if (diff.baseline)
+                results[diff.modified.GetPath()] = diff.result;
+            USD_MAYA_RETURN_QUICK_RESULT(diff.quickResult, results);
+            if (!diff.baseline)
+                results[diff.modified.GetPath()] = diff.result;
+        }
     }
 
     // Identify children that are absent in the modified prim.
@@ -284,6 +284,12 @@ DiffFunc getDiffFunction(const VtValue& modified, const VtValue& baseline)
 
 DiffResult compareValues(const VtValue& modified, const VtValue& baseline)
 {
+    // Arrays of the same type that are equal, in particular when they share their data, do not
+    // need the element-wise comparison with tolerance.
+    if (modified.IsArrayValued() && modified.GetTypeid() == baseline.GetTypeid()
+        && modified == baseline)
+        return DiffResult::Same;
+
     DiffFunc diff = getDiffFunction(modified, baseline);
     return diff(modified, baseline);
 }
@@ -24,6 +24,8 @@
 #include <pxr/usd/usdGeom/xformCommonAPI.h>
 
 #include <algorithm>
+#include <iterator>
+#include <map>
 #include <utility>
 
 namespace MayaUsdUtils {
@@ -45,6 +47,12 @@ struct MergeContext
     const SdfPath&           srcRootPath;
     const UsdStageRefPtr&    dstStage;
     const SdfPath&           dstRootPath;
+
+    // Source paths of the subtrees that are missing from the destination.
+    SdfPathSet& createdSubtrees;
+
+    // Cache of the local transform comparisons, per source prim path.
+    std::map<SdfPath, bool>& localTransformModified;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -248,6 +256,22 @@ bool isLocalTransformModified(const UsdPrim& srcPrim, const UsdPrim& dstPrim)
     return false;
 }
 
+/// Verifies if the local transform was modified, once per prim rather than once per transform
+/// property.
+bool isLocalTransformModified(
+    const MergeContext& ctx,
+    const UsdPrim&      srcPrim,
+    const UsdPrim&      dstPrim)
+{
+    const auto iter = ctx.localTransformModified.find(srcPrim.GetPath());
+    if (iter != ctx.localTransformModified.end())
+        return iter->second;
+
+    const bool modified = isLocalTransformModified(srcPrim, dstPrim);
+    ctx.localTransformModified[srcPrim.GetPath()] = modified;
+    return modified;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Special normal attributes handling.
 //
@@ -313,6 +337,104 @@ bool isMetadataPreserved(const TfToken& metadata, MergeMissing missingHandling)
         return isMetadataAlwaysPreserved(metadata);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+// Created subtrees handling.
+//
+// When the destination has no prim at all for a source subtree, for example for a new hierarchy,
+// every field of the subtree is found to be modified. These subtrees are found before the merge
+// and their fields and children are then copied without being compared one by one.
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Verifies if the options create everything that is missing from the destination.
+bool createsAllMissing(const MergePrimsOptions& options)
+{
+    const MergeMissing handlings[] = {
+        options.propertiesHandling,    options.primsHandling,        options.connectionsHandling,
+        options.relationshipsHandling, options.variantsHandling,     options.variantSetsHandling,
+        options.expressionsHandling,   options.mappersHandling,      options.mapperArgsHandling,
+        options.propMetadataHandling,  options.primMetadataHandling,
+    };
+    return std::all_of(std::begin(handlings), std::end(handlings), [](MergeMissing handling) {
+        return contains(handling, MergeMissing::Create);
+    });
+}
+
+/// Verifies if the source path is inside a subtree missing from the destination.
+bool isInCreatedSubtree(const MergeContext& ctx, const SdfPath& srcPath)
+{
+    if (ctx.createdSubtrees.empty())
+        return false;
+
+    for (SdfPath path = srcPath; !path.IsEmpty(); path = path.GetParentPath()) {
+        if (ctx.createdSubtrees.count(path) > 0)
+            return true;
+    }
+
+    return false;
+}
+
+/// Verifies if all the specs of a source subtree missing from the destination would be copied
+/// by the merge: they must be on prims that exist in the source stage and there must be no normals
+/// to drop.
+bool isSubtreeCopiedAsIs(
+    const MergeContext&   ctx,
+    const SdfLayerHandle& srcLayer,
+    const SdfPath&        path)
+{
+    bool copiedAsIs = true;
+    srcLayer->Traverse(path, [&ctx, &copiedAsIs](const SdfPath& specPath) {
+        if (!copiedAsIs)
+            return;
+
+        if (specPath.IsPropertyPath() && isUndesiredNormalsProperty(specPath.GetNameToken())) {
+            copiedAsIs = false;
+        } else if (!ctx.srcStage->GetPrimAtPath(
+                       specPath.GetPrimPath().StripAllVariantSelections())) {
+            copiedAsIs = false;
+        }
+    });
+    return copiedAsIs;
+}
+
+/// Finds the descendants of the source root that are missing from the destination.
+///
+/// The root itself is always merged field by field: the destination prim exists by then, since
+/// the merge creates it, and its composed metadata could match the source ones.
+void findCreatedSubtrees(
+    const MergeContext&   ctx,
+    const SdfLayerHandle& srcLayer,
+    const SdfLayerHandle& dstLayer)
+{
+    if (!ctx.options.mergeChildren || !createsAllMissing(ctx.options))
+        return;
+
+    SdfPrimSpecHandleVector toVisit = { srcLayer->GetPrimAtPath(ctx.srcRootPath) };
+    while (!toVisit.empty()) {
+        const SdfPrimSpecHandle spec = toVisit.back();
+        toVisit.pop_back();
+        if (!spec)
+            continue;
+
+        for (const SdfPrimSpecHandle& child : spec->GetNameChildren()) {
+            const SdfPath& srcChildPath = child->GetPath();
+            const SdfPath  dstChildPath
+                = srcChildPath.ReplacePrefix(ctx.srcRootPath, ctx.dstRootPath);
+            const bool isMissing = !dstLayer->HasSpec(dstChildPath)
+                && !ctx.dstStage->GetPrimAtPath(dstChildPath.StripAllVariantSelections());
+            if (isMissing && isSubtreeCopiedAsIs(ctx, srcLayer, srcChildPath)) {
+                ctx.createdSubtrees.insert(srcChildPath);
+                printAboutField(
+                    ctx,
+                    { srcLayer, srcChildPath, TfToken(), true },
+                    MergeVerbosity::Child,
+                    "copy subtree missing from destination. ");
+            } else {
+                toVisit.push_back(child);
+            }
+        }
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 // Merge Prims
 //----------------------------------------------------------------------------------------------------------------------
@@ -407,7 +529,7 @@ bool isDataAtPathsModified(
         //       representation differed, for example for USD data coming from another
         //       tool that use a different transform operation order.
         if (isTransformProperty(srcProp)) {
-            const bool changed = isLocalTransformModified(srcPrim, dstPrim);
+            const bool changed = isLocalTransformModified(ctx, srcPrim, dstPrim);
             if (!changed) {
                 printChangedField(ctx, src, "transform prop local trf", changed);
                 return changed;
@@ -486,6 +608,9 @@ bool shouldMergeValue(
         return false;
     }
 
+    if (isInCreatedSubtree(ctx, srcPath))
+        return true;
+
     const MergeLocation dst = { dstLayer, dstPath, field, fieldInDst };
     return isDataAtPathsModified(ctx, src, dst);
 }
@@ -790,6 +915,32 @@ void unionChildren(
     dstChildrenValue = dstChildren;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/// Merges and filters the children of a given type.
+template <class ChildPolicy>
+bool mergeTypedChildren(
+    const MergeContext&  ctx,
+    const MergeMissing   missingHandling,
+    const MergeLocation& src,
+    const MergeLocation& dst,
+    VtValue&             srcChildrenValue,
+    VtValue&             dstChildrenValue)
+{
+    typedef typename ChildPolicy::FieldType FieldType;
+    typedef std::vector<FieldType>          ChildrenVector;
+
+    unionChildren<ChildPolicy>(missingHandling, srcChildrenValue, dstChildrenValue);
+
+    // All the children of subtrees missing from the destination are kept.
+    if (isInCreatedSubtree(ctx, src.path)) {
+        return srcChildrenValue.IsHolding<ChildrenVector>()
+            && !srcChildrenValue.UncheckedGet<ChildrenVector>().empty();
+    }
+
+    return filterTypedChildren<ChildPolicy>(
+        ctx, missingHandling, src, dst, srcChildrenValue, dstChildrenValue);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /// Filters the children.
 bool filterChildren(
@@ -801,58 +952,48 @@ bool filterChildren(
 {
     if (src.field == SdfChildrenKeys->ConnectionChildren) {
         const auto missingHandling = ctx.options.connectionsHandling;
-        unionChildren<Sdf_AttributeConnectionChildPolicy>(
-            missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_AttributeConnectionChildPolicy>(
+        return mergeTypedChildren<Sdf_AttributeConnectionChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->MapperChildren) {
         const auto missingHandling = ctx.options.mappersHandling;
-        unionChildren<Sdf_MapperChildPolicy>(missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_MapperChildPolicy>(
+        return mergeTypedChildren<Sdf_MapperChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->MapperArgChildren) {
         const auto missingHandling = ctx.options.mapperArgsHandling;
-        unionChildren<Sdf_MapperArgChildPolicy>(missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_MapperArgChildPolicy>(
+        return mergeTypedChildren<Sdf_MapperArgChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->ExpressionChildren) {
         const auto missingHandling = ctx.options.expressionsHandling;
-        unionChildren<Sdf_ExpressionChildPolicy>(missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_ExpressionChildPolicy>(
+        return mergeTypedChildren<Sdf_ExpressionChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->RelationshipTargetChildren) {
         const auto missingHandling = ctx.options.relationshipsHandling;
-        unionChildren<Sdf_RelationshipTargetChildPolicy>(missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_RelationshipTargetChildPolicy>(
+        return mergeTypedChildren<Sdf_RelationshipTargetChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->VariantChildren) {
         const auto missingHandling = ctx.options.variantsHandling;
-        unionChildren<Sdf_VariantChildPolicy>(missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_VariantChildPolicy>(
+        return mergeTypedChildren<Sdf_VariantChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->VariantSetChildren) {
         const auto missingHandling = ctx.options.variantSetsHandling;
-        unionChildren<Sdf_VariantSetChildPolicy>(missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_VariantSetChildPolicy>(
+        return mergeTypedChildren<Sdf_VariantSetChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->PropertyChildren) {
         const auto missingHandling = ctx.options.propertiesHandling;
-        unionChildren<Sdf_PropertyChildPolicy>(missingHandling, srcChildren, dstChildren);
-        return filterTypedChildren<Sdf_PropertyChildPolicy>(
+        return mergeTypedChildren<Sdf_PropertyChildPolicy>(
             ctx, missingHandling, src, dst, srcChildren, dstChildren);
     }
     if (src.field == SdfChildrenKeys->PrimChildren) {
         if (ctx.options.mergeChildren) {
             const auto missingHandling = ctx.options.primsHandling;
-            unionChildren<Sdf_PrimChildPolicy>(missingHandling, srcChildren, dstChildren);
-            return filterTypedChildren<Sdf_PrimChildPolicy>(
+            return mergeTypedChildren<Sdf_PrimChildPolicy>(
                 ctx, missingHandling, src, dst, srcChildren, dstChildren);
         } else {
             return false;
@@ -927,7 +1068,13 @@ bool mergeDiffPrims(
     const SdfLayerRefPtr&    dstLayer,
     const SdfPath&           dstPath)
 {
-    const MergeContext ctx = { options, srcStage, srcPath, dstStage, dstPath };
+    SdfPathSet              createdSubtrees;
+    std::map<SdfPath, bool> localTransformModified;
+    const MergeContext      ctx = {
+        options, srcStage, srcPath, dstStage, dstPath, createdSubtrees, localTransformModified,
+    };
+
+    findCreatedSubtrees(ctx, srcLayer, dstLayer);
 
     auto copyValue = makeFuncWithContext(ctx, shouldMergeValue);
     auto copyChildren = makeFuncWithContext(ctx, shouldMergeChildren);
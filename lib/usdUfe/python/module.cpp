@@ -22,6 +22,7 @@ TF_WRAP_MODULE
 {
     TF_WRAP(EditRouter);
     TF_WRAP(Global);
+    TF_WRAP(NotificationGuard);
     TF_WRAP(Tokens);
     TF_WRAP(Utils);
 }
@@ -119,6 +119,19 @@ void wrapEditRouter()
 
     def("restoreAllDefaultEditRouters", &UsdUfe::restoreAllDefaultEditRouters);
 
+    def("enableEditRouterCache", &UsdUfe::enableEditRouterCache);
+
+    def("isEditRouterCacheEnabled", &UsdUfe::isEditRouterCacheEnabled);
+
+    def("clearEditRouterCache", &UsdUfe::clearEditRouterCache);
+
+    def("getEditRouterCacheStats", &UsdUfe::getEditRouterCacheStats);
+
+    using StatsThis = UsdUfe::EditRouterCacheStats;
+    class_<StatsThis>("EditRouterCacheStats", no_init)
+        .def_readonly("hits", &StatsThis::hits)
+        .def_readonly("misses", &StatsThis::misses);
+
     using OpThis = UsdUfe::OperationEditRouterContext;
     class_<OpThis, boost::noncopyable>("OperationEditRouterContext", no_init)
         .def("__init__", make_constructor(OperationEditRouterContextInit));
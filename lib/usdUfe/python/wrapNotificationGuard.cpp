@@ -0,0 +1,61 @@
+//
+// Copyright 2023 Autodesk
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <usdUfe/ufe/StagesSubject.h>
+
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/return_arg.hpp>
+
+#include <memory>
+
+using namespace boost::python;
+
+namespace {
+
+// This exposes AttributeChangedNotificationGuard as a Python "context
+// manager" object that can be used with the "with" statement.
+class _PyAttributeChangedNotificationGuard
+{
+public:
+    _PyAttributeChangedNotificationGuard(size_t subtreeCoalescingThreshold = 0)
+        : _subtreeCoalescingThreshold(subtreeCoalescingThreshold)
+    {
+    }
+
+    void __enter__()
+    {
+        _guard.reset(new UsdUfe::AttributeChangedNotificationGuard(_subtreeCoalescingThreshold));
+    }
+
+    void __exit__(object, object, object) { _guard.reset(); }
+
+private:
+    size_t                                                     _subtreeCoalescingThreshold;
+    std::shared_ptr<UsdUfe::AttributeChangedNotificationGuard> _guard;
+};
+
+} // anonymous namespace
+
+void wrapNotificationGuard()
+{
+    typedef _PyAttributeChangedNotificationGuard Guard;
+    class_<Guard>(
+        "AttributeChangedNotificationGuard",
+        "Context manager delaying attribute changed notifications until it exits",
+        init<optional<size_t>>())
+        .def("__enter__", &Guard::__enter__, return_self<>())
+        .def("__exit__", &Guard::__exit__);
+}
@@ -38,6 +38,9 @@
 #include <ufe/transform3d.h>
 
 #include <regex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace {
@@ -74,59 +77,90 @@ enum class AttributeChangeType
 
 struct AttributeNotification
 {
-    AttributeNotification(const Ufe::Path& path, const TfToken& token, AttributeChangeType type)
-        : _path(path)
-        , _token(token)
-        , _type(type)
-    {
-    }
-
-    virtual ~AttributeNotification() { }
-
-    Ufe::Path           _path;
-    TfToken             _token;
-    AttributeChangeType _type;
-
-    bool operator==(const AttributeNotification& other)
-    {
-        // Only collapse multiple value changes. Collapsing added/removed notifications needs to be
-        // done safely so the observer ends up in the right state.
-        return other._type == _type && other._token == _token && other._path == _path
-            && _type == AttributeChangeType::kValueChanged;
-    }
+    Ufe::Path             _path;
+    TfToken               _token;
+    AttributeChangeType   _type;
+    std::set<std::string> _metadataKeys; // Only used by metadata changes.
 };
 
-struct AttributeMetadataNotification : public AttributeNotification
+// Keep the pending attribute notifications in a vector, since the order of
+// notifs must be maintained, along with a hash index of the notifs which can
+// be collapsed. Finding a duplicate is then constant time instead of linear
+// in the number of pending notifs, which made large batched edits quadratic.
+class PendingAttributeNotifications
 {
-    AttributeMetadataNotification(
+public:
+    void add(
         const Ufe::Path&             path,
         const TfToken&               token,
         AttributeChangeType          type,
-        const std::set<std::string>& metadataKeys)
-        : AttributeNotification(path, token, type)
-        , _metadataKeys(metadataKeys)
+        const std::set<std::string>& metadataKeys = {})
     {
+        // Only collapse multiple value and metadata changes. Collapsing added/removed
+        // notifications needs to be done safely so the observer ends up in the right state.
+        if (type != AttributeChangeType::kValueChanged
+            && type != AttributeChangeType::kMetadataChanged) {
+            _notifications.push_back({ path, token, type, metadataKeys });
+            return;
+        }
+
+        // Don't add pending notif if one already exists with same path/token.
+        const size_t hash = hashNotification(path, token, type);
+        const auto   range = _index.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            AttributeNotification& pending = _notifications[it->second];
+            if (pending._type == type && pending._token == token && pending._path == path) {
+                pending._metadataKeys.insert(metadataKeys.begin(), metadataKeys.end());
+                return;
+            }
+        }
+
+        _index.emplace(hash, _notifications.size());
+        _notifications.push_back({ path, token, type, metadataKeys });
+
+        if (type == AttributeChangeType::kValueChanged) {
+            ++_valueChangeCounts[path];
+        }
     }
 
-    ~AttributeMetadataNotification() override { }
+    bool empty() const { return _notifications.empty(); }
+
+    const std::vector<AttributeNotification>& notifications() const { return _notifications; }
+
+    // Number of attributes with a pending value change on the given prim.
+    size_t valueChangeCount(const Ufe::Path& path) const
+    {
+        const auto found = _valueChangeCounts.find(path);
+        return found != _valueChangeCounts.end() ? found->second : 0;
+    }
 
-    std::set<std::string> _metadataKeys;
+    void clear()
+    {
+        _notifications.clear();
+        _index.clear();
+        _valueChangeCounts.clear();
+    }
 
-    bool operator==(const AttributeMetadataNotification& other)
+private:
+    static size_t
+    hashNotification(const Ufe::Path& path, const TfToken& token, AttributeChangeType type)
     {
-        // Only collapse multiple value changes. Collapsing added/removed notifications needs to be
-        // done safely so the observer ends up in the right state.
-        return other._type == _type && other._token == _token && other._path == _path
-            && _type == AttributeChangeType::kMetadataChanged;
+        size_t hash = std::hash<Ufe::Path>()(path);
+        hash ^= TfToken::HashFunctor()(token) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= static_cast<size_t>(type) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
     }
+
+    std::vector<AttributeNotification>      _notifications;
+    std::unordered_multimap<size_t, size_t> _index; // hash -> index in _notifications
+    std::unordered_map<Ufe::Path, size_t>   _valueChangeCounts;
 };
 
-// Keep an array of the pending attribute notifications. Using a vector
-// for two main reasons:
-// 1) Order of notifs must be maintained.
-// 2) Allow notif with same path, but different token. At worst the check is linear
-//    in the size of the vector (which is the same as an unordered_multimap).
-std::vector<AttributeNotification> pendingAttributeChangedNotifications;
+PendingAttributeNotifications pendingAttributeChangedNotifications;
+
+// When non-zero, the value changes of a prim are folded into a single subtree
+// invalidate notification if the prim has more than this number of changes.
+size_t pendingSubtreeCoalescingThreshold { 0 };
 
 bool inAttributeChangedNotificationGuard()
 {
@@ -197,19 +231,22 @@ void sendAttributeMetadataChanged(
 }
 #endif
 
+void sendSubtreeInvalidate(const Ufe::Path& ufePath)
+{
+    try {
+        if (auto sceneItem = Ufe::Hierarchy::createItem(ufePath)) {
+            Ufe::Scene::instance().notify(Ufe::SubtreeInvalidate(sceneItem));
+        }
+    } catch (const std::exception& ex) {
+        TF_WARN("Caught error during notification: %s", ex.what());
+    }
+}
+
 void valueChanged(const Ufe::Path& ufePath, const TfToken& changedToken)
 {
     if (inAttributeChangedNotificationGuard()) {
-        // Don't add pending notif if one already exists with same path/token.
-        auto p
-            = AttributeNotification { ufePath, changedToken, AttributeChangeType::kValueChanged };
-        if (std::find(
-                pendingAttributeChangedNotifications.begin(),
-                pendingAttributeChangedNotifications.end(),
-                p)
-            == pendingAttributeChangedNotifications.end()) {
-            pendingAttributeChangedNotifications.emplace_back(p);
-        }
+        pendingAttributeChangedNotifications.add(
+            ufePath, changedToken, AttributeChangeType::kValueChanged);
     } else {
         sendAttributeChanged(ufePath, changedToken, AttributeChangeType::kValueChanged);
     }
@@ -222,15 +259,7 @@ void attributeChanged(
     AttributeChangeType changeType)
 {
     if (inAttributeChangedNotificationGuard()) {
-        // Don't add pending notif if one already exists with same path/token.
-        auto p = AttributeNotification { ufePath, changedToken, changeType };
-        if (std::find(
-                pendingAttributeChangedNotifications.begin(),
-                pendingAttributeChangedNotifications.end(),
-                p)
-            == pendingAttributeChangedNotifications.end()) {
-            pendingAttributeChangedNotifications.emplace_back(p);
-        }
+        pendingAttributeChangedNotifications.add(ufePath, changedToken, changeType);
     } else {
         sendAttributeChanged(ufePath, changedToken, changeType);
     }
@@ -245,22 +274,7 @@ void attributeMetadataChanged(
     const std::set<std::string>& metadataKeys)
 {
     if (inAttributeChangedNotificationGuard()) {
-        // Don't add pending notif if one already exists with same path/token.
-        auto p = AttributeMetadataNotification(ufePath, changedToken, changeType, metadataKeys);
-        auto p2 = std::find(
-            pendingAttributeChangedNotifications.begin(),
-            pendingAttributeChangedNotifications.end(),
-            p);
-        if (p2 == pendingAttributeChangedNotifications.end()) {
-            pendingAttributeChangedNotifications.emplace_back(p);
-        } else {
-            auto p2AttributeMetadataNotification
-                = dynamic_cast<AttributeMetadataNotification*>(&(*p2));
-            if (p2AttributeMetadataNotification) {
-                p2AttributeMetadataNotification->_metadataKeys.insert(
-                    metadataKeys.begin(), metadataKeys.end());
-            }
-        }
+        pendingAttributeChangedNotifications.add(ufePath, changedToken, changeType, metadataKeys);
     } else {
         sendAttributeMetadataChanged(ufePath, changedToken, changeType, metadataKeys);
     }
@@ -630,6 +644,12 @@ void StagesSubject::sendSubtreeInvalidate(const Ufe::SceneItem::Ptr& sceneItem)
     }
 }
 AttributeChangedNotificationGuard::AttributeChangedNotificationGuard()
+    : AttributeChangedNotificationGuard(0)
+{
+}
+
+AttributeChangedNotificationGuard::AttributeChangedNotificationGuard(
+    size_t subtreeCoalescingThreshold)
 {
     if (inAttributeChangedNotificationGuard()) {
         TF_CODING_ERROR("Attribute changed notification guard cannot be nested.");
@@ -640,6 +660,10 @@ AttributeChangedNotificationGuard::AttributeChangedNotificationGuard()
         TF_CODING_ERROR("Stale pending attribute changed notifications.");
     }
 
+    if (attributeChangedNotificationGuardCount.load() == 0) {
+        pendingSubtreeCoalescingThreshold = subtreeCoalescingThreshold;
+    }
+
     ++attributeChangedNotificationGuardCount;
 }
 
@@ -653,18 +677,27 @@ AttributeChangedNotificationGuard::~AttributeChangedNotificationGuard()
         return;
     }
 
-    for (const auto& notificationInfo : pendingAttributeChangedNotifications) {
+    std::unordered_set<Ufe::Path> coalescedPaths;
+
+    for (const auto& notificationInfo : pendingAttributeChangedNotifications.notifications()) {
         if (notificationInfo._type == AttributeChangeType::kMetadataChanged) {
 #ifdef UFE_V4_FEATURES_AVAILABLE
-            if (const auto metadataNotificationInfo
-                = dynamic_cast<const AttributeMetadataNotification*>(&notificationInfo)) {
-                sendAttributeMetadataChanged(
-                    metadataNotificationInfo->_path,
-                    metadataNotificationInfo->_token,
-                    metadataNotificationInfo->_type,
-                    metadataNotificationInfo->_metadataKeys);
-            }
+            sendAttributeMetadataChanged(
+                notificationInfo._path,
+                notificationInfo._token,
+                notificationInfo._type,
+                notificationInfo._metadataKeys);
 #endif
+        } else if (
+            notificationInfo._type == AttributeChangeType::kValueChanged
+            && pendingSubtreeCoalescingThreshold > 0
+            && pendingAttributeChangedNotifications.valueChangeCount(notificationInfo._path)
+                > pendingSubtreeCoalescingThreshold) {
+            // Fold the value changes of the prim into a single subtree invalidate,
+            // sent in place of its first value change.
+            if (coalescedPaths.insert(notificationInfo._path).second) {
+                sendSubtreeInvalidate(notificationInfo._path);
+            }
         } else {
             sendAttributeChanged(
                 notificationInfo._path, notificationInfo._token, notificationInfo._type);
@@ -672,6 +705,7 @@ AttributeChangedNotificationGuard::~AttributeChangedNotificationGuard()
     }
 
     pendingAttributeChangedNotifications.clear();
+    pendingSubtreeCoalescingThreshold = 0;
 }
 
 } // namespace USDUFE_NS_DEF
@@ -92,11 +92,16 @@ protected:
         The guard collapses down notifications for a given UFE path, which is
         desirable to avoid duplicate notifications.  However, it is an error to
         have notifications for more than one attribute within a single guard.
+
+        When constructed with a non-zero subtree coalescing threshold, the value
+        changes of a prim with more than that number of changed attributes are
+        folded into a single subtree invalidate notification on the prim.
  */
 class USDUFE_PUBLIC AttributeChangedNotificationGuard
 {
 public:
     AttributeChangedNotificationGuard();
+    explicit AttributeChangedNotificationGuard(size_t subtreeCoalescingThreshold);
     ~AttributeChangedNotificationGuard();
 
     //@{
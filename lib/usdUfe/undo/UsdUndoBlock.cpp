@@ -40,7 +40,11 @@ UsdUndoBlock::~UsdUndoBlock()
         // transfer edits
         UsdUfe::UsdUndoManagerAccessor::transferEdits(*_undoItem);
 
-        TF_DEBUG_MSG(USDUFE_UNDOSTACK, "Undoable Item adopted the new edits.\n");
+        TF_DEBUG_MSG(
+            USDUFE_UNDOSTACK,
+            "Undoable Item adopted %zu new edits holding %zu bytes.\n",
+            _undoItem->size(),
+            _undoItem->memoryUsage());
     }
 
     TF_DEBUG_MSG(USDUFE_UNDOSTACK, "--Closed undo block at depth %i\n", _undoBlockDepth);
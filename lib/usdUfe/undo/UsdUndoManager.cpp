@@ -19,6 +19,8 @@
 #include <usdUfe/undo/UsdUndoBlock.h>
 #include <usdUfe/undo/UsdUndoStateDelegate.h>
 
+#include <pxr/usd/sdf/schema.h>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 
 namespace USDUFE_NS_DEF {
@@ -40,6 +42,23 @@ void UsdUndoManager::trackLayerStates(const SdfLayerHandle& layer)
     }
 }
 
+bool UsdUndoManager::_RecordedInverse::operator==(const _RecordedInverse& other) const
+{
+    return _delegate == other._delegate && _isTimeSample == other._isTimeSample
+        && _time == other._time && _path == other._path && _fieldName == other._fieldName;
+}
+
+size_t UsdUndoManager::_RecordedInverseHash::operator()(const _RecordedInverse& key) const
+{
+    size_t hash = std::hash<const void*>()(key._delegate);
+    hash ^= SdfPath::Hash()(key._path) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= TfToken::HashFunctor()(key._fieldName) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    if (key._isTimeSample) {
+        hash ^= std::hash<double>()(key._time) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
 void UsdUndoManager::addInverse(UsdUndoableItem::InvertFunc func)
 {
     if (UsdUndoBlock::depth() == 0) {
@@ -47,13 +66,59 @@ void UsdUndoManager::addInverse(UsdUndoableItem::InvertFunc func)
         return;
     }
 
-    _invertFuncs.emplace_back(func);
+    // The inverse of a structural edit may rely on the field values at the time it is
+    // recorded, so field writes that follow it must record their own inverse again.
+    _recordedInverses.clear();
+
+    _edits.addInverse(std::move(func));
+}
+
+void UsdUndoManager::addInverse(UsdUndoableItem::FieldInverse&& inverse)
+{
+    if (UsdUndoBlock::depth() == 0) {
+        TF_CODING_ERROR("Collecting invert functions outside of undoblock is not allowed!");
+        return;
+    }
+
+    _edits.addInverse(std::move(inverse));
+}
+
+bool UsdUndoManager::_claim(_RecordedInverse&& key)
+{
+    if (UsdUndoBlock::depth() == 0) {
+        return false;
+    }
+
+    return _recordedInverses.insert(std::move(key)).second;
+}
+
+bool UsdUndoManager::claimFieldInverse(
+    const UsdUndoStateDelegate* delegate,
+    const SdfPath&              path,
+    const TfToken&              fieldName)
+{
+    return _claim({ delegate, path, fieldName, 0.0, false });
+}
+
+bool UsdUndoManager::claimTimeSampleInverse(
+    const UsdUndoStateDelegate* delegate,
+    const SdfPath&              path,
+    double                      time)
+{
+    // Restoring the whole time samples field also restores this sample.
+    if (_recordedInverses.count({ delegate, path, SdfFieldKeys->TimeSamples, 0.0, false }) > 0) {
+        return false;
+    }
+
+    return _claim({ delegate, path, SdfFieldKeys->TimeSamples, time, true });
 }
 
 void UsdUndoManager::transferEdits(UsdUndoableItem& undoableItem)
 {
     // transfer the edits
-    undoableItem._invertFuncs = std::move(_invertFuncs);
+    undoableItem = std::move(_edits);
+    _edits = UsdUndoableItem();
+    _recordedInverses.clear();
 }
 
 } // namespace USDUFE_NS_DEF
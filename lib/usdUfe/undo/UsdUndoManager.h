@@ -23,6 +23,7 @@
 #include <pxr/usd/sdf/layer.h>
 
 #include <functional>
+#include <unordered_set>
 #include <vector>
 
 PXR_NAMESPACE_USING_DIRECTIVE
@@ -35,6 +36,10 @@ namespace USDUFE_NS_DEF {
     1- tracking layer state changes from UsdUndoStateDelegate
     2- collecting InvertFunc() in every state change
     3- transferring collected edits into an UsdUndoableItem
+
+    Within an undo block, only the first inverse of a given (layer, path, field, time) is
+    recorded: later ones would be overwritten by it on undo. Any other kind of edit ends the
+    coalescing, since its inverse may depend on the intermediate field values.
 */
 class USDUFE_PUBLIC UsdUndoManager
 {
@@ -58,10 +63,35 @@ private:
     ~UsdUndoManager() = default;
 
     void addInverse(UsdUndoableItem::InvertFunc func);
+    void addInverse(UsdUndoableItem::FieldInverse&& inverse);
+    bool claimFieldInverse(
+        const UsdUndoStateDelegate* delegate,
+        const SdfPath&              path,
+        const TfToken&              fieldName);
+    bool
+    claimTimeSampleInverse(const UsdUndoStateDelegate* delegate, const SdfPath& path, double time);
     void transferEdits(UsdUndoableItem& undoableItem);
 
 private:
-    UsdUndoableItem::InvertFuncs _invertFuncs;
+    struct _RecordedInverse
+    {
+        const UsdUndoStateDelegate* _delegate;
+        SdfPath                     _path;
+        TfToken                     _fieldName;
+        double                      _time;
+        bool                        _isTimeSample;
+
+        bool operator==(const _RecordedInverse& other) const;
+    };
+    struct _RecordedInverseHash
+    {
+        size_t operator()(const _RecordedInverse& key) const;
+    };
+
+    bool _claim(_RecordedInverse&& key);
+
+    UsdUndoableItem                                            _edits;
+    std::unordered_set<_RecordedInverse, _RecordedInverseHash> _recordedInverses;
 };
 
 //! \brief Helper struct which exists only to provide controlled,
@@ -83,6 +113,25 @@ public:
         auto& undoManager = UsdUfe::UsdUndoManager::instance();
         undoManager.addInverse(func);
     }
+    static void addInverse(UsdUndoableItem::FieldInverse&& inverse)
+    {
+        auto& undoManager = UsdUfe::UsdUndoManager::instance();
+        undoManager.addInverse(std::move(inverse));
+    }
+    static bool claimFieldInverse(
+        const UsdUndoStateDelegate* delegate,
+        const SdfPath&              path,
+        const TfToken&              fieldName)
+    {
+        auto& undoManager = UsdUfe::UsdUndoManager::instance();
+        return undoManager.claimFieldInverse(delegate, path, fieldName);
+    }
+    static bool
+    claimTimeSampleInverse(const UsdUndoStateDelegate* delegate, const SdfPath& path, double time)
+    {
+        auto& undoManager = UsdUfe::UsdUndoManager::instance();
+        return undoManager.claimTimeSampleInverse(delegate, path, time);
+    }
     static void transferEdits(UsdUndoableItem& undoableItem)
     {
         auto& undoManager = UsdUfe::UsdUndoManager::instance();
@@ -256,26 +256,7 @@ void UsdUndoStateDelegate::_OnSetField(
     const TfToken& fieldName,
     const VtValue& value)
 {
-    _MarkCurrentStateAsDirty();
-
-    // early return if we are not inside an UsdUndoBlock
-    if (UsdUndoBlock::depth() == 0) {
-        return;
-    }
-
-    if (!_setMessageAlreadyShowed) {
-        TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
-            .Msg("Setting Field '%s' for Spec '%s'\n", fieldName.GetText(), path.GetText());
-    }
-
-    if (!_layer) {
-        return;
-    }
-
-    const VtValue inverseValue = _layer->GetField(path, fieldName);
-
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    _OnSetFieldImpl(path, fieldName);
 }
 
 void UsdUndoStateDelegate::_OnSetField(
@@ -283,27 +264,7 @@ void UsdUndoStateDelegate::_OnSetField(
     const TfToken&                   fieldName,
     const SdfAbstractDataConstValue& value)
 {
-    _MarkCurrentStateAsDirty();
-
-    // early return if we are not inside an UsdUndoBlock
-    if (UsdUndoBlock::depth() == 0) {
-        return;
-    }
-
-    if (!_setMessageAlreadyShowed) {
-        TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
-            .Msg("Setting Field '%s' for Spec '%s'\n", fieldName.GetText(), path.GetText());
-    }
-
-    if (!_layer) {
-        return;
-    }
-
-    const VtValue inverseValue = _layer->GetField(path, fieldName);
-
-    // add invert
-    UsdUfe::UsdUndoManagerAccessor::addInverse(
-        std::bind(&UsdUndoStateDelegate::invertSetField, this, path, fieldName, inverseValue));
+    _OnSetFieldImpl(path, fieldName);
 }
 
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKey(
@@ -512,6 +473,33 @@ void UsdUndoStateDelegate::_OnPopChild(
         &UsdUndoStateDelegate::invertPopPathChild, this, parentPath, fieldName, oldValue));
 }
 
+void UsdUndoStateDelegate::_OnSetFieldImpl(const SdfPath& path, const TfToken& fieldName)
+{
+    _MarkCurrentStateAsDirty();
+
+    // early return if we are not inside an UsdUndoBlock
+    if (UsdUndoBlock::depth() == 0) {
+        return;
+    }
+
+    if (!_setMessageAlreadyShowed) {
+        TF_DEBUG(USDUFE_UNDOSTATEDELEGATE)
+            .Msg("Setting Field '%s' for Spec '%s'\n", fieldName.GetText(), path.GetText());
+    }
+
+    if (!_layer) {
+        return;
+    }
+
+    // only the first write of a field needs to be inverted within an undo block
+    if (!UsdUfe::UsdUndoManagerAccessor::claimFieldInverse(this, path, fieldName)) {
+        return;
+    }
+
+    UsdUfe::UsdUndoManagerAccessor::addInverse(
+        { this, path, fieldName, _layer->GetField(path, fieldName), 0.0, false });
+}
+
 void UsdUndoStateDelegate::_OnSetFieldDictValueByKeyImpl(
     const SdfPath& path,
     const TfToken& fieldName,
@@ -561,20 +549,26 @@ void UsdUndoStateDelegate::_OnSetTimeSampleImpl(const SdfPath& path, double time
         .Msg("Setting time sample '%f' for spec '%s'\n", time, path.GetText());
 
     if (!_GetLayer()->HasField(path, SdfFieldKeys->TimeSamples)) {
-        UsdUfe::UsdUndoManagerAccessor::addInverse(std::bind(
-            &UsdUndoStateDelegate::invertSetField,
-            this,
-            path,
-            SdfFieldKeys->TimeSamples,
-            VtValue()));
+        if (!UsdUfe::UsdUndoManagerAccessor::claimFieldInverse(
+                this, path, SdfFieldKeys->TimeSamples)) {
+            return;
+        }
+
+        UsdUfe::UsdUndoManagerAccessor::addInverse(
+            { this, path, SdfFieldKeys->TimeSamples, VtValue(), 0.0, false });
 
     } else {
+        // only the first write of a sample needs to be inverted within an undo block
+        if (!UsdUfe::UsdUndoManagerAccessor::claimTimeSampleInverse(this, path, time)) {
+            return;
+        }
+
         VtValue oldValue;
 
         _GetLayer()->QueryTimeSample(path, time, &oldValue);
 
         UsdUfe::UsdUndoManagerAccessor::addInverse(
-            std::bind(&UsdUndoStateDelegate::invertSetTimeSample, this, path, time, oldValue));
+            { this, path, SdfFieldKeys->TimeSamples, std::move(oldValue), time, true });
     }
 }
 
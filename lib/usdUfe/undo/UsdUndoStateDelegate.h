@@ -37,7 +37,8 @@ TF_DECLARE_WEAK_AND_REF_PTRS(UsdUndoStateDelegate);
 
     There exist exactly one invert function for every authoring operation. These invert functions
    are collected by UsdUndoManager::addInverse() call which then will be transfered to an
-   UsdUndoableItem object when UsdUndoBlock expires.
+   UsdUndoableItem object when UsdUndoBlock expires. Field and time sample writes are recorded
+   as typed inverses, and only for the first write of each field or sample in the block.
 */
 class USDUFE_PUBLIC UsdUndoStateDelegate : public SdfLayerStateDelegateBase
 {
@@ -48,6 +49,8 @@ public:
     static UsdUndoStateDelegateRefPtr New();
 
 private:
+    friend class UsdUndoableItem;
+
     void invertSetField(const SdfPath& path, const TfToken& fieldName, const VtValue& inverse);
     void invertCreateSpec(const SdfPath& path, bool inert);
     void invertDeleteSpec(
@@ -114,6 +117,7 @@ protected:
         override;
 
 private:
+    void _OnSetFieldImpl(const SdfPath& path, const TfToken& fieldName);
     void _OnSetFieldDictValueByKeyImpl(
         const SdfPath& path,
         const TfToken& fieldName,
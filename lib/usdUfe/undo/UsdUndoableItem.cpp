@@ -17,15 +17,59 @@
 #include "UsdUndoableItem.h"
 
 #include <usdUfe/undo/UsdUndoBlock.h>
+#include <usdUfe/undo/UsdUndoStateDelegate.h>
 
+#include <pxr/base/tf/type.h>
 #include <pxr/usd/sdf/changeBlock.h>
 
+namespace {
+
+size_t valueMemoryUsage(const VtValue& value)
+{
+    if (value.IsEmpty()) {
+        return 0;
+    }
+
+    size_t bytes = value.GetType().GetSizeof();
+    if (value.IsArrayValued()) {
+        const size_t elementSize = TfType::Find(value.GetElementTypeid()).GetSizeof();
+        bytes += value.GetArraySize() * (elementSize > 0 ? elementSize : sizeof(void*));
+    }
+    return bytes;
+}
+
+} // namespace
+
 namespace USDUFE_NS_DEF {
 
 void UsdUndoableItem::undo() { doInvert(); }
 
 void UsdUndoableItem::redo() { doInvert(); }
 
+size_t UsdUndoableItem::memoryUsage() const
+{
+    size_t bytes = sizeof(UsdUndoableItem);
+    bytes += _entries.capacity() * sizeof(Entry);
+    bytes += _invertFuncs.capacity() * sizeof(InvertFunc);
+    bytes += _fieldInverses.capacity() * sizeof(FieldInverse);
+    for (const FieldInverse& inverse : _fieldInverses) {
+        bytes += valueMemoryUsage(inverse._value);
+    }
+    return bytes;
+}
+
+void UsdUndoableItem::addInverse(InvertFunc func)
+{
+    _entries.push_back({ 0u, static_cast<uint32_t>(_invertFuncs.size()) });
+    _invertFuncs.emplace_back(std::move(func));
+}
+
+void UsdUndoableItem::addInverse(FieldInverse&& inverse)
+{
+    _entries.push_back({ 1u, static_cast<uint32_t>(_fieldInverses.size()) });
+    _fieldInverses.emplace_back(std::move(inverse));
+}
+
 void UsdUndoableItem::doInvert()
 {
     if (UsdUndoBlock::depth() != 0) {
@@ -38,8 +82,20 @@ void UsdUndoableItem::doInvert()
     // call invert functions in reverse order
     {
         SdfChangeBlock changeBlock;
-        for (auto it = _invertFuncs.rbegin(); it != _invertFuncs.rend(); ++it) {
-            (*it)();
+        for (auto it = _entries.rbegin(); it != _entries.rend(); ++it) {
+            if (!it->_isFieldInverse) {
+                _invertFuncs[it->_index]();
+                continue;
+            }
+
+            const FieldInverse& inverse = _fieldInverses[it->_index];
+            if (inverse._isTimeSample) {
+                inverse._delegate->invertSetTimeSample(
+                    inverse._path, inverse._time, inverse._value);
+            } else {
+                inverse._delegate->invertSetField(
+                    inverse._path, inverse._fieldName, inverse._value);
+            }
         }
     }
 }
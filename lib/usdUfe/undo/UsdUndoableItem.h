@@ -19,15 +19,27 @@
 
 #include <usdUfe/base/api.h>
 
+#include <pxr/base/tf/token.h>
+#include <pxr/base/vt/value.h>
+#include <pxr/usd/sdf/path.h>
+
+#include <cstdint>
 #include <functional>
 #include <vector>
 
+PXR_NAMESPACE_USING_DIRECTIVE
+
 namespace USDUFE_NS_DEF {
 
+class UsdUndoStateDelegate;
+
 //! \brief UsdUndoableItem
 /*!
-    This class stores the list of inverse edit functions that are invoked
-    on undo() / redo() call. This is the object that must be placed in DCC's undo stack.
+    This class stores the list of inverse edits that are invoked on undo() / redo() call.
+    This is the object that must be placed in DCC's undo stack.
+
+    Field and time sample writes, which make up the bulk of the edits, are kept as compact
+    typed entries. Every other edit is kept as an inverse function.
 */
 class USDUFE_PUBLIC UsdUndoableItem
 {
@@ -35,6 +47,18 @@ public:
     using InvertFunc = std::function<void()>;
     using InvertFuncs = std::vector<InvertFunc>;
 
+    //! \brief Inverse of a field or time sample write on a layer.
+    struct FieldInverse
+    {
+        UsdUndoStateDelegate* _delegate { nullptr }; //!< Delegate of the edited layer
+        SdfPath               _path;                 //!< Spec path
+        TfToken               _fieldName;            //!< Restored field
+        VtValue               _value;                //!< Value to restore
+        double                _time { 0.0 };         //!< Sample time, if _isTimeSample
+        bool                  _isTimeSample { false };
+    };
+    using FieldInverses = std::vector<FieldInverse>;
+
     // default constructor/destructor
     UsdUndoableItem() = default;
     ~UsdUndoableItem() = default;
@@ -50,12 +74,37 @@ public:
     void undo();
     void redo();
 
+    //! \brief Returns true if the item holds no edits.
+    bool empty() const { return _entries.empty(); }
+
+    //! \brief Returns the number of recorded edits.
+    size_t size() const { return _entries.size(); }
+
+    //! \brief Returns an estimate of the memory held by the item, in bytes.
+    /*!
+        Array values are counted in full even though they may share their storage with the
+        layer. Inverse functions are counted at their own size only.
+    */
+    size_t memoryUsage() const;
+
 private:
     friend class UsdUndoManager;
 
+    void addInverse(InvertFunc func);
+    void addInverse(FieldInverse&& inverse);
+
     void doInvert();
 
-    InvertFuncs _invertFuncs;
+    //! Position of an edit in either _invertFuncs or _fieldInverses, in recording order.
+    struct Entry
+    {
+        uint32_t _isFieldInverse : 1;
+        uint32_t _index : 31;
+    };
+
+    std::vector<Entry> _entries;
+    InvertFuncs        _invertFuncs;
+    FieldInverses      _fieldInverses;
 };
 
 } // namespace USDUFE_NS_DEF
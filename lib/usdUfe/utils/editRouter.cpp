@@ -19,9 +19,14 @@
 
 #include <pxr/base/tf/callContext.h>
 #include <pxr/base/tf/diagnosticLite.h>
+#include <pxr/base/tf/notice.h>
 #include <pxr/base/tf/token.h>
+#include <pxr/base/tf/weakBase.h>
+#include <pxr/usd/sdf/changeList.h>
+#include <pxr/usd/sdf/notice.h>
 #include <pxr/usd/sdf/primSpec.h>
 #include <pxr/usd/usd/editContext.h>
+#include <pxr/usd/usd/notice.h>
 #include <pxr/usd/usd/payloads.h>
 #include <pxr/usd/usd/references.h>
 #include <pxr/usd/usd/stage.h>
@@ -29,6 +34,8 @@
 #include <pxr/usd/usd/variantSets.h>
 #include <pxr/usd/usdGeom/gprim.h>
 
+#include <unordered_map>
+
 namespace {
 
 UsdUfe::EditRouters& getRegisterdDefaultEditRouters()
@@ -59,6 +66,225 @@ void editTargetLayer(const PXR_NS::VtDictionary& context, PXR_NS::VtDictionary&
     routingData[EditRoutingTokens->Layer] = PXR_NS::VtValue(layer);
 }
 
+// Return whether the changes to a layer may change the layer stacks that
+// contain it, or the layers found by identifier.
+bool changesLayerStack(const PXR_NS::SdfChangeList& changeList)
+{
+    for (const auto& pathAndEntry : changeList.GetEntryList()) {
+        const PXR_NS::SdfChangeList::Entry& entry = pathAndEntry.second;
+        if (!entry.subLayerChanges.empty() || entry.flags.didReplaceContent
+            || entry.flags.didReloadContent || entry.flags.didChangeIdentifier) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Cache of the layers computed by the edit routers, per stage.  See
+// UsdUfe::enableEditRouterCache() for the conditions of its use.
+class EditRouterCache : public PXR_NS::TfWeakBase
+{
+public:
+    struct Key
+    {
+        PXR_NS::TfToken operation;
+        PXR_NS::SdfPath primPath;
+        PXR_NS::TfToken attrName;
+
+        bool operator==(const Key& rhs) const
+        {
+            return operation == rhs.operation && primPath == rhs.primPath
+                && attrName == rhs.attrName;
+        }
+    };
+
+    static EditRouterCache& instance()
+    {
+        static EditRouterCache cache;
+        return cache;
+    }
+
+    bool isEnabled() const { return _enabled; }
+
+    void enable(bool enable)
+    {
+        PXR_NAMESPACE_USING_DIRECTIVE
+
+        if (enable == _enabled)
+            return;
+
+        _enabled = enable;
+        clear();
+
+        if (enable) {
+            TfWeakPtr<EditRouterCache> me(this);
+            _noticeKeys.push_back(TfNotice::Register(me, &EditRouterCache::layersDidChange));
+            _noticeKeys.push_back(TfNotice::Register(me, &EditRouterCache::editTargetChanged));
+            _noticeKeys.push_back(TfNotice::Register(me, &EditRouterCache::layerMutingChanged));
+        } else {
+            TfNotice::Revoke(&_noticeKeys);
+        }
+    }
+
+    bool find(const PXR_NS::UsdPrim& prim, const Key& key, PXR_NS::SdfLayerHandle* layer)
+    {
+        const auto foundStage = _stages.find(prim.GetStage().GetUniqueIdentifier());
+        if (foundStage != _stages.end()) {
+            const auto& layers = foundStage->second.layers;
+            const auto  found = layers.find(key);
+            // A routed layer that has expired since must be routed again.
+            if (found != layers.end() && (!found->second.routed || found->second.layer)) {
+                *layer = found->second.layer;
+                ++_stats.hits;
+                return true;
+            }
+        }
+
+        ++_stats.misses;
+        return false;
+    }
+
+    void insert(const PXR_NS::UsdPrim& prim, const Key& key, const PXR_NS::SdfLayerHandle& layer)
+    {
+        const PXR_NS::UsdStagePtr stage = prim.GetStage();
+        const void*               stageId = stage.GetUniqueIdentifier();
+
+        auto found = _stages.find(stageId);
+        if (found == _stages.end()) {
+            eraseExpiredStages();
+            found = _stages.emplace(stageId, StageEntries { stage, {} }).first;
+        }
+        found->second.layers[key] = Entry { layer, bool(layer) };
+    }
+
+    // Remove all entries, but keep the statistics.
+    void invalidate() { _stages.clear(); }
+
+    void clear()
+    {
+        _stages.clear();
+        _stats = UsdUfe::EditRouterCacheStats();
+    }
+
+    const UsdUfe::EditRouterCacheStats& stats() const { return _stats; }
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            size_t hash = key.operation.Hash();
+            hash ^= key.primPath.GetHash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= key.attrName.Hash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    struct Entry
+    {
+        PXR_NS::SdfLayerHandle layer;
+        bool                   routed;
+    };
+
+    // The stage is held so that its unique identifier is not reused while
+    // its entries exist.
+    struct StageEntries
+    {
+        PXR_NS::UsdStageWeakPtr                 stage;
+        std::unordered_map<Key, Entry, KeyHash> layers;
+    };
+
+    void eraseExpiredStages()
+    {
+        for (auto it = _stages.begin(); it != _stages.end();) {
+            it = it->second.stage ? std::next(it) : _stages.erase(it);
+        }
+    }
+
+    void layersDidChange(const PXR_NS::SdfNotice::LayersDidChange& notice)
+    {
+        for (const auto& layerAndChanges : notice.GetChangeListVec()) {
+            if (!changesLayerStack(layerAndChanges.second))
+                continue;
+
+            const PXR_NS::SdfLayerHandle& layer = layerAndChanges.first;
+            for (auto it = _stages.begin(); it != _stages.end();) {
+                const PXR_NS::UsdStageWeakPtr& stage = it->second.stage;
+                const bool affected = !stage || stage->HasLocalLayer(layer);
+                it = affected ? _stages.erase(it) : std::next(it);
+            }
+        }
+    }
+
+    void editTargetChanged(const PXR_NS::UsdNotice::StageEditTargetChanged& notice)
+    {
+        _stages.erase(notice.GetStage().GetUniqueIdentifier());
+    }
+
+    void layerMutingChanged(const PXR_NS::UsdNotice::LayerMutingChanged& notice)
+    {
+        _stages.erase(notice.GetStage().GetUniqueIdentifier());
+    }
+
+    std::unordered_map<const void*, StageEntries> _stages;
+    UsdUfe::EditRouterCacheStats                  _stats;
+    PXR_NS::TfNotice::Keys                        _noticeKeys;
+    bool                                          _enabled { false };
+};
+
+// Retrieve the layer from the routing data, which can hold a layer identifier
+// or a layer handle.
+PXR_NS::SdfLayerHandle
+getRoutedLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::VtDictionary& routingData)
+{
+    const auto found = routingData.find(EditRoutingTokens->Layer);
+    if (found == routingData.end())
+        return nullptr;
+
+    const auto& value = found->second;
+    if (value.IsHolding<std::string>()) {
+        std::string            layerName = value.Get<std::string>();
+        PXR_NS::SdfLayerRefPtr layer = prim.GetStage()->GetRootLayer()->Find(layerName);
+        return layer;
+        // FIXME  We should always be using a string layer identifier, for
+        // Python and C++ compatibility, so the following code should be
+        // removed, and client code using edit routing should be adjusted
+        // accordingly.  PPT, 27-Jan-2022.
+    } else if (value.IsHolding<PXR_NS::SdfLayerHandle>()) {
+        return value.Get<PXR_NS::SdfLayerHandle>();
+    } else {
+        return nullptr;
+    }
+}
+
+// Route the operation on the prim, or on the attribute of the prim if the
+// attribute name is not empty, unless the edit router cache has the layer.
+PXR_NS::SdfLayerHandle routeToLayer(
+    UsdUfe::EditRouter&    editRouter,
+    const PXR_NS::TfToken& operation,
+    const PXR_NS::UsdPrim& prim,
+    const PXR_NS::TfToken& attrName)
+{
+    EditRouterCache&           cache = EditRouterCache::instance();
+    const EditRouterCache::Key key { operation, prim.GetPath(), attrName };
+    PXR_NS::SdfLayerHandle     layer;
+    if (cache.isEnabled() && cache.find(prim, key, &layer))
+        return layer;
+
+    PXR_NS::VtDictionary context;
+    PXR_NS::VtDictionary routingData;
+    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
+    context[EditRoutingTokens->Operation] = operation;
+    if (!attrName.IsEmpty())
+        context[operation] = PXR_NS::VtValue(attrName);
+    editRouter(context, routingData);
+
+    layer = getRoutedLayer(prim, routingData);
+    if (cache.isEnabled())
+        cache.insert(prim, key, layer);
+    return layer;
+}
+
 } // namespace
 
 namespace USDUFE_NS_DEF {
@@ -103,6 +329,7 @@ EditRouters defaultEditRouters()
 void registerEditRouter(const PXR_NS::TfToken& operation, const EditRouter::Ptr& editRouter)
 {
     getRegisteredEditRouters()[operation] = editRouter;
+    EditRouterCache::instance().invalidate();
 }
 
 bool restoreDefaultEditRouter(const PXR_NS::TfToken& operation)
@@ -126,12 +353,14 @@ bool restoreDefaultEditRouter(const PXR_NS::TfToken& operation)
         return false;
 
     editRouters.erase(pos);
+    EditRouterCache::instance().invalidate();
     return true;
 }
 
 void restoreAllDefaultEditRouters()
 {
     getRegisteredEditRouters().clear();
+    EditRouterCache::instance().invalidate();
 
     auto defaults = defaultEditRouters();
     for (const auto& entry : defaults) {
@@ -154,31 +383,7 @@ getEditRouterLayer(const PXR_NS::TfToken& operation, const PXR_NS::UsdPrim& prim
     if (!dstEditRouter)
         return nullptr;
 
-    PXR_NS::VtDictionary context;
-    PXR_NS::VtDictionary routingData;
-    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
-    context[EditRoutingTokens->Operation] = operation;
-    (*dstEditRouter)(context, routingData);
-
-    // Try to retrieve the layer from the routing data.
-    const auto found = routingData.find(EditRoutingTokens->Layer);
-    if (found == routingData.end())
-        return nullptr;
-
-    const auto& value = found->second;
-    if (value.IsHolding<std::string>()) {
-        std::string            layerName = value.Get<std::string>();
-        PXR_NS::SdfLayerRefPtr layer = prim.GetStage()->GetRootLayer()->Find(layerName);
-        return layer;
-        // FIXME  We should always be using a string layer identifier, for
-        // Python and C++ compatibility, so the following code should be
-        // removed, and client code using edit routing should be adjusted
-        // accordingly.  PPT, 27-Jan-2022.
-    } else if (value.IsHolding<PXR_NS::SdfLayerHandle>()) {
-        return value.Get<PXR_NS::SdfLayerHandle>();
-    } else {
-        return nullptr;
-    }
+    return routeToLayer(*dstEditRouter, operation, prim, PXR_NS::TfToken());
 }
 
 PXR_NS::SdfLayerHandle
@@ -190,27 +395,15 @@ getAttrEditRouterLayer(const PXR_NS::UsdPrim& prim, const PXR_NS::TfToken& attrN
     if (!dstEditRouter)
         return nullptr;
 
-    PXR_NS::VtDictionary context;
-    PXR_NS::VtDictionary routingData;
-    context[EditRoutingTokens->Prim] = PXR_NS::VtValue(prim);
-    context[EditRoutingTokens->Operation] = attrOp;
-    context[attrOp] = PXR_NS::VtValue(attrName);
-    (*dstEditRouter)(context, routingData);
+    return routeToLayer(*dstEditRouter, attrOp, prim, attrName);
+}
 
-    // Try to retrieve the layer from the routing data.
-    const auto found = routingData.find(EditRoutingTokens->Layer);
-    if (found == routingData.end())
-        return nullptr;
+void enableEditRouterCache(bool enable) { EditRouterCache::instance().enable(enable); }
 
-    const auto& value = found->second;
-    if (value.IsHolding<std::string>()) {
-        std::string layerName = value.Get<std::string>();
-        return prim.GetStage()->GetRootLayer()->Find(layerName);
-    } else if (value.IsHolding<PXR_NS::SdfLayerHandle>()) {
-        return value.Get<PXR_NS::SdfLayerHandle>();
-    } else {
-        return nullptr;
-    }
-}
+bool isEditRouterCacheEnabled() { return EditRouterCache::instance().isEnabled(); }
+
+void clearEditRouterCache() { EditRouterCache::instance().clear(); }
+
+EditRouterCacheStats getEditRouterCacheStats() { return EditRouterCache::instance().stats(); }
 
 } // namespace USDUFE_NS_DEF
@@ -109,4 +109,33 @@ void registerDefaultEditRouter(const PXR_NS::TfToken&, const EditRouter::Ptr&);
 // Return built-in default edit routers.
 EditRouters defaultEditRouters();
 
+// Statistics of the edit router cache, since it was enabled or cleared.
+struct USDUFE_PUBLIC EditRouterCacheStats
+{
+    size_t hits { 0 };
+    size_t misses { 0 };
+};
+
+// Enable or disable the cache of the layers returned by getEditRouterLayer()
+// and getAttrEditRouterLayer().  The cache is keyed by stage, operation, prim
+// path and attribute name, so it must only be enabled when the edit routers
+// depend on nothing else than these, the layer stack and the edit target.
+// Entries are invalidated when the layer stack, the layer muting or the edit
+// target of their stage change, and when an edit router is registered or
+// restored.  The cache is disabled by default, and disabling it clears it.
+USDUFE_PUBLIC
+void enableEditRouterCache(bool enable);
+
+// Return whether the edit router cache is enabled.
+USDUFE_PUBLIC
+bool isEditRouterCacheEnabled();
+
+// Clear the edit router cache and its statistics.
+USDUFE_PUBLIC
+void clearEditRouterCache();
+
+// Return the hit and miss counts of the edit router cache.
+USDUFE_PUBLIC
+EditRouterCacheStats getEditRouterCacheStats();
+
 } // namespace USDUFE_NS_DEF
@@ -22,17 +22,105 @@
 
 #include <maya/MAnimControl.h>
 #include <maya/MAnimUtil.h>
+#include <maya/MDGContext.h>
+#include <maya/MDGContextGuard.h>
 #include <maya/MFnAnimCurve.h>
 #include <maya/MFnDagNode.h>
+#include <maya/MFnMatrixData.h>
 #include <maya/MItDependencyGraph.h>
 #include <maya/MMatrix.h>
 #include <maya/MNodeClass.h>
 #include <maya/MTypes.h> // For MAYA_APP_VERSION
 
+#include <pxr/usd/sdf/layer.h>
+#include <pxr/usd/sdf/schema.h>
+#include <pxr/usd/usd/editTarget.h>
+#include <pxr/usd/usd/stage.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace AL {
 namespace usdmaya {
 namespace fileio {
 
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+MMatrix worldMatrix(const MDagPath& path)
+{
+    MFnDagNode fn(path);
+    MPlug      plug = fn.findPlug("worldMatrix", true).elementByLogicalIndex(path.instanceNumber());
+    return MFnMatrixData(plug.asMObject()).matrix();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// \brief  Buffers the time samples of the exported attributes while the frames are sampled, and
+///         writes all the samples of each attribute in a single edit once the frames are done.
+/// \note   The samples are set on attributes of an in-memory stage with the same names and types as
+///         the exported ones, so that the copyAttributeValue helpers can fill them as they are.
+class SampleBuffer
+{
+public:
+    SampleBuffer()
+        : m_stage(UsdStage::CreateInMemory())
+    {
+    }
+
+    /// \brief  adds a buffer for the exported attribute
+    /// \param  attribute the exported attribute
+    /// \return the attribute the samples are set on in place of the exported attribute
+    UsdAttribute add(const UsdAttribute& attribute)
+    {
+        UsdPrim      prim = m_stage->OverridePrim(attribute.GetPrim().GetPath());
+        UsdAttribute buffer = prim.CreateAttribute(
+            attribute.GetName(), attribute.GetTypeName(), attribute.IsCustom());
+        m_attributes.emplace_back(buffer, attribute);
+        return buffer;
+    }
+
+    /// \brief  writes the buffered samples to the edit target of each exported attribute
+    void flush()
+    {
+        std::vector<double> times;
+        for (const auto& attributes : m_attributes) {
+            const UsdAttribute& buffer = attributes.first;
+            UsdAttribute        attribute = attributes.second;
+            if (!buffer.GetTimeSamples(&times) || times.empty()) {
+                continue;
+            }
+
+            const UsdEditTarget editTarget = attribute.GetStage()->GetEditTarget();
+            const SdfLayerHandle layer = editTarget.GetLayer();
+            const SdfPath        specPath = editTarget.MapToSpecPath(attribute.GetPath());
+            const SdfLayerOffset stageToLayer = editTarget.GetMapFunction().GetTimeOffset().GetInverse();
+
+            VtValue value;
+            if (!layer->HasSpec(specPath)) {
+                // the first sample authors the attribute spec in the edit target
+                buffer.Get(&value, times.front());
+                attribute.Set(value, UsdTimeCode(times.front()));
+            }
+
+            SdfTimeSampleMap samples
+                = layer->GetFieldAs<SdfTimeSampleMap>(specPath, SdfFieldKeys->TimeSamples);
+            for (const double time : times) {
+                if (buffer.Get(&value, time)) {
+                    samples[stageToLayer * time] = value;
+                }
+            }
+            layer->SetField(specPath, SdfFieldKeys->TimeSamples, VtValue(samples));
+        }
+    }
+
+private:
+    UsdStageRefPtr                                     m_stage;
+    std::vector<std::pair<UsdAttribute, UsdAttribute>> m_attributes;
+};
+
+} // namespace
+
 //----------------------------------------------------------------------------------------------------------------------
 void AnimationTranslator::exportAnimation(const ExporterParams& params)
 {
@@ -52,23 +140,69 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
     if ((startAttrib != endAttrib) || (startAttribScaled != endAttribScaled)
         || (startTransformAttrib != endTransformAttrib) || (startMultiAttrib != endMultiAttrib)
         || (startMesh != endMesh) || (startWSM != endWSM) || (!m_animatedNodes.empty())) {
-        double increment = 1.0 / std::max(1U, params.m_subSamples);
-        for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e; t += increment) {
-            MAnimControl::setCurrentTime(t);
-            UsdTimeCode timeCode(t);
-            for (auto it = startAttrib; it != endAttrib; ++it) {
+        // The mesh export contexts only read the topology and author the uniform attributes when
+        // constructed, so a single context per mesh is reused for every frame. A context keeps a
+        // reference to its mesh, so each mesh is allocated along with its context.
+        struct MeshExport
+        {
+            MeshExport(const MDagPath& path, const UsdPrim& prim, UsdTimeCode timeCode)
+                : mesh(prim)
+                , context(path, mesh, timeCode)
+            {
+            }
+
+            UsdGeomMesh                           mesh;
+            AL::usdmaya::utils::MeshExportContext context;
+        };
+        std::vector<std::unique_ptr<MeshExport>> meshExports;
+        meshExports.reserve(m_animatedMeshes.size());
+        for (auto it = startMesh; it != endMesh; ++it) {
+            meshExports.emplace_back(
+                new MeshExport(it->first, it->second.GetPrim(), UsdTimeCode(params.m_minFrame)));
+        }
+
+        // The plug values are buffered and written once per attribute after the frames are
+        // sampled, so the stage only processes one change per attribute. The mesh contexts author
+        // their own attributes, and keep writing to the stage on each frame.
+        SampleBuffer              sampleBuffer;
+        std::vector<UsdAttribute> attribBuffers;
+        std::vector<UsdAttribute> scaledBuffers;
+        std::vector<UsdAttribute> transformBuffers;
+        std::vector<UsdAttribute> multiBuffers;
+        std::vector<UsdAttribute> worldSpaceBuffers;
+        for (auto it = startAttrib; it != endAttrib; ++it) {
+            attribBuffers.push_back(sampleBuffer.add(it->second));
+        }
+        for (auto it = startAttribScaled; it != endAttribScaled; ++it) {
+            scaledBuffers.push_back(sampleBuffer.add(it->second.attr));
+        }
+        for (auto it = startTransformAttrib; it != endTransformAttrib; ++it) {
+            transformBuffers.push_back(sampleBuffer.add(it->second));
+        }
+        for (auto it = startMultiAttrib; it != endMultiAttrib; ++it) {
+            multiBuffers.push_back(sampleBuffer.add(it->first));
+        }
+        for (auto it = startWSM; it != endWSM; ++it) {
+            worldSpaceBuffers.push_back(sampleBuffer.add(it->second));
+        }
+
+        auto exportFrame = [&](const UsdTimeCode timeCode) {
+            auto attribBuffer = attribBuffers.begin();
+            for (auto it = startAttrib; it != endAttrib; ++it, ++attribBuffer) {
                 /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
                 ///         maya::Dg
                 ///         usdmaya::Dg
                 ///         usdmaya::fileio::translator::Dg
 #if MAYA_APP_VERSION > 2019
                 translators::TransformTranslator::copyAttributeValue(
-                    it->first, it->second, timeCode, params.m_mergeOffsetParentMatrix);
+                    it->first, *attribBuffer, timeCode, params.m_mergeOffsetParentMatrix);
 #else
-                translators::DgNodeTranslator::copyAttributeValue(it->first, it->second, timeCode);
+                translators::DgNodeTranslator::copyAttributeValue(
+                    it->first, *attribBuffer, timeCode);
 #endif
             }
-            for (auto it = startAttribScaled; it != endAttribScaled; ++it) {
+            auto scaledBuffer = scaledBuffers.begin();
+            for (auto it = startAttribScaled; it != endAttribScaled; ++it, ++scaledBuffer) {
                 /// \todo This feels wrong. Split the DgNodeTranslator class into 3 ...
                 ///         maya::Dg
                 ///         usdmaya::Dg
@@ -76,20 +210,23 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
 #if MAYA_APP_VERSION > 2019
                 translators::TransformTranslator::copyAttributeValue(
                     it->first,
-                    it->second.attr,
+                    *scaledBuffer,
                     it->second.scale,
                     timeCode,
                     params.m_mergeOffsetParentMatrix);
 #else
                 translators::DgNodeTranslator::copyAttributeValue(
-                    it->first, it->second.attr, it->second.scale, timeCode);
+                    it->first, *scaledBuffer, it->second.scale, timeCode);
 #endif
             }
-            for (auto it = startTransformAttrib; it != endTransformAttrib; ++it) {
+            auto transformBuffer = transformBuffers.begin();
+            for (auto it = startTransformAttrib; it != endTransformAttrib;
+                 ++it, ++transformBuffer) {
                 translators::TransformTranslator::copyAttributeValue(
-                    it->first, it->second, timeCode);
+                    it->first, *transformBuffer, timeCode);
             }
-            for (auto it = startMultiAttrib; it != endMultiAttrib; ++it) {
+            auto multiBuffer = multiBuffers.begin();
+            for (auto it = startMultiAttrib; it != endMultiAttrib; ++it, ++multiBuffer) {
                 // Note: so far there is only one attribute need to be treated specially
                 //       we do this special handling for this particular attribute atm,
                 //       will see if we need to generalize once have more requests
@@ -103,30 +240,67 @@ void AnimationTranslator::exportAnimation(const ExporterParams& params)
                             static_cast<float>(nearDistance.as(MDistance::kCentimeters)),
                             static_cast<float>(farDistance.as(MDistance::kCentimeters))
                         };
-                        it->first.Set(clippingRange, timeCode);
+                        multiBuffer->Set(clippingRange, timeCode);
                     }
                 }
             }
-            for (auto it = startMesh; it != endMesh; ++it) {
-                UsdGeomMesh                           mesh(it->second.GetPrim());
-                AL::usdmaya::utils::MeshExportContext context(it->first, mesh, timeCode);
-                context.copyVertexData(timeCode);
-            }
-            for (auto nodeAnim : m_animatedNodes) {
-                nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
+            for (const auto& meshExport : meshExports) {
+                meshExport->context.copyVertexData(timeCode);
             }
-            for (auto it = startWSM; it != endWSM; ++it) {
-                MMatrix mat = it->first.inclusiveMatrix();
+            auto worldSpaceBuffer = worldSpaceBuffers.begin();
+            for (auto it = startWSM; it != endWSM; ++it, ++worldSpaceBuffer) {
+                // the world matrix plug is read rather than the DAG path, as it follows the
+                // evaluation context.
+                MMatrix mat = params.m_contextEvaluation ? worldMatrix(it->first)
+                                                         : it->first.inclusiveMatrix();
 #ifdef __GNUC__
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif
-                it->second.Set(*(const GfMatrix4d*)&mat, timeCode);
+                worldSpaceBuffer->Set(*(const GfMatrix4d*)&mat, timeCode);
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
             }
+        };
+
+        auto exportCustomAnimFrame = [&](const UsdTimeCode timeCode) {
+            for (auto nodeAnim : m_animatedNodes) {
+                nodeAnim.m_translator->exportCustomAnim(nodeAnim.m_path, nodeAnim.m_prim, timeCode);
+            }
+        };
+
+        double increment = 1.0 / std::max(1U, params.m_subSamples);
+        if (params.m_contextEvaluation) {
+            // The plugs are read through an evaluation context for each frame, so the current time
+            // and the rest of the scene are left untouched.
+            for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e;
+                 t += increment) {
+                const MDGContext frameContext(MTime(t, MTime::uiUnit()));
+                MDGContextGuard  contextGuard(frameContext);
+                exportFrame(UsdTimeCode(t));
+            }
+
+            // Plugin translators may query the scene in ways that only see the current time, so
+            // their custom animation keeps the time-changing path.
+            if (!m_animatedNodes.empty()) {
+                for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e;
+                     t += increment) {
+                    MAnimControl::setCurrentTime(t);
+                    exportCustomAnimFrame(UsdTimeCode(t));
+                }
+            }
+        } else {
+            for (double t = params.m_minFrame, e = params.m_maxFrame + 1e-3f; t < e;
+                 t += increment) {
+                MAnimControl::setCurrentTime(t);
+                UsdTimeCode timeCode(t);
+                exportFrame(timeCode);
+                exportCustomAnimFrame(timeCode);
+            }
         }
+
+        sampleBuffer.flush();
     }
 }
 
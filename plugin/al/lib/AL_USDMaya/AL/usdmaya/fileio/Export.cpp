@@ -1121,6 +1121,11 @@ MStatus ExportCommand::doIt(const MArgList& args)
             argData.getFlagArgument("fs", 0, m_params.m_filterSample),
             "ALUSDExport: Unable to fetch \"filter sample\" argument");
     }
+    if (argData.isFlagSet("ce", &status)) {
+        AL_MAYA_CHECK_ERROR(
+            argData.getFlagArgument("ce", 0, m_params.m_contextEvaluation),
+            "ALUSDExport: Unable to fetch \"context evaluation\" argument");
+    }
     if (argData.isFlagSet("eac", &status)) {
         AL_MAYA_CHECK_ERROR(
             argData.getFlagArgument("eac", 0, m_params.m_extensiveAnimationCheck),
@@ -1260,6 +1265,8 @@ MSyntax ExportCommand::createSyntax()
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-eac", "-extensiveAnimationCheck", MSyntax::kBoolean);
     AL_MAYA_CHECK_ERROR2(status, errorString);
+    status = syntax.addFlag("-ce", "-contextEvaluation", MSyntax::kBoolean);
+    AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-ss", "-subSamples", MSyntax::kUnsigned);
     AL_MAYA_CHECK_ERROR2(status, errorString);
     status = syntax.addFlag("-ws", "-worldSpace", MSyntax::kBoolean);
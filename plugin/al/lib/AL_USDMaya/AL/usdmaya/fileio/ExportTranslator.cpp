@@ -91,6 +91,7 @@ MStatus ExportTranslator::writer(
         params.m_animTranslator = new AnimationTranslator;
     }
     params.m_filterSample = options.getBool(kFilterSample);
+    params.m_contextEvaluation = options.getBool(kContextEvaluation);
     if (params.m_selected) {
         MGlobal::getActiveSelectionList(params.m_nodes);
     } else {
@@ -75,6 +75,8 @@ static constexpr const char* const kSubSamples
     = "Sub Samples"; ///< specify the number of sub samples to export
 static constexpr const char* const kFilterSample
     = "Filter Sample"; ///< export filter sample option name
+static constexpr const char* const kContextEvaluation
+    = "Context Evaluation"; ///< sample the animation without changing the current time option name
 static constexpr const char* const kExportAtWhichTime
     = "Export At Which Time"; ///< which time code should be used for default values?
 static constexpr const char* const kExportInWorldSpace
@@ -125,6 +127,8 @@ static MStatus specifyOptions(AL::maya::utils::FileTranslatorOptions& options)
         return MS::kFailure;
     if (!options.addBool(kFilterSample, defaultValues.m_filterSample))
         return MS::kFailure;
+    if (!options.addBool(kContextEvaluation, defaultValues.m_contextEvaluation))
+        return MS::kFailure;
     if (!options.addEnum(kExportAtWhichTime, timelineLevel, defaultValues.m_exportAtWhichTime))
         return MS::kFailure;
     if (!options.addBool(kExportInWorldSpace, defaultValues.m_exportInWorldSpace))
@@ -92,30 +92,30 @@ MStatus MeshAnimDeformer::compute(const MPlug& plug, MDataBlock& data)
     MObject obj = inputHandle.asMesh();
 
     UsdStageRefPtr stage = getStage();
-    if (stage) {
-        UsdPrim     prim = stage->GetPrimAtPath(m_cachePath);
-        UsdGeomMesh mesh(prim);
+    if (stage && m_cachePath.IsPrimPath()) {
+        const SdfPath pointsPath = m_cachePath.AppendProperty(UsdGeomTokens->points);
+        const SdfPath normalsPath = m_cachePath.AppendProperty(UsdGeomTokens->normals);
 
         MFnMesh      fnMesh(obj);
         float* const ptr = (float*)fnMesh.getRawPoints(&status);
-        if (ptr) {
-            UsdAttribute points = mesh.GetPointsAttr();
-            if (points.GetNumTimeSamples() > 1) {
+        if (ptr && m_pointsCache.SetAttribute(stage, pointsPath)) {
+            if (m_pointsCache.ValueMightBeTimeVarying()) {
                 VtArray<GfVec3f> pointData;
-                points.Get(&pointData, usdTime);
-                const size_t numPoints = pointData.size();
-                std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * numPoints);
+                if (m_pointsCache.Get(usdTime, &pointData)) {
+                    const size_t numPoints = pointData.size();
+                    std::memcpy(ptr, pointData.cdata(), sizeof(float) * 3 * numPoints);
+                }
             }
         }
 
         float* const nptr = (float*)fnMesh.getRawNormals(&status);
-        if (nptr) {
-            UsdAttribute normals = mesh.GetNormalsAttr();
-            if (normals.GetNumTimeSamples() > 1) {
+        if (nptr && m_normalsCache.SetAttribute(stage, normalsPath)) {
+            if (m_normalsCache.ValueMightBeTimeVarying()) {
                 VtArray<GfVec3f> normalData;
-                normals.Get(&normalData, usdTime);
-                const size_t numNormals = normalData.size();
-                std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * numNormals);
+                if (m_normalsCache.Get(usdTime, &normalData)) {
+                    const size_t numNormals = normalData.size();
+                    std::memcpy(nptr, normalData.cdata(), sizeof(float) * 3 * numNormals);
+                }
             }
         }
         outputHandle.set(obj);
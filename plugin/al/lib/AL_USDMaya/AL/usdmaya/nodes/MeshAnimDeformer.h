@@ -17,6 +17,8 @@
 #include "AL/maya/utils/MayaHelperMacros.h"
 #include "AL/maya/utils/NodeHelper.h"
 
+#include <mayaUsd/utils/vec3fArraySampleCache.h>
+
 #include <pxr/usd/usd/stage.h>
 
 #include <maya/MNodeMessage.h>
@@ -71,9 +73,11 @@ private:
     UsdStageRefPtr getStage();
 
 private:
-    SdfPath       m_cachePath;
-    MObjectHandle proxyShapeHandle;
-    MCallbackId   m_attributeChanged = 0;
+    SdfPath                      m_cachePath;
+    MObjectHandle                proxyShapeHandle;
+    MCallbackId                  m_attributeChanged = 0;
+    UsdMayaVec3fArraySampleCache m_pointsCache;
+    UsdMayaVec3fArraySampleCache m_normalsCache;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
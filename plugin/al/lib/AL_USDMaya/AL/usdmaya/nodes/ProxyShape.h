@@ -546,6 +546,10 @@ public:
     AL_USDMAYA_PUBLIC
     void getCounts(SdfPath path, uint32_t& selected, uint32_t& required, uint32_t& refCount);
 
+    /// \brief  a method that is used within testing only. Returns the sorted paths of the prims
+    /// tagged with the excludeFromProxyShape metadata
+    const SdfPathVector& excludedTaggedGeometry() const { return m_excludedTaggedGeometry; }
+
     /// \brief  Tests to see if a given MObject is currently selected in the proxy shape. If the
     /// specified MObject is
     ///         selected, then the path will be filled with the corresponding usd prim path.
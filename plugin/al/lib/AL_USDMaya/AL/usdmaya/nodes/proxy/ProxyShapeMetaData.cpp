@@ -16,13 +16,20 @@
 
 #include "AL/usdmaya/Metadata.h"
 #include "AL/usdmaya/fileio/SchemaPrims.h"
-#include "AL/usdmaya/fileio/TransformIterator.h"
 #include "AL/usdmaya/nodes/ProxyShape.h"
 #include "AL/usdmaya/nodes/Transform.h"
 
 #include <mayaUsd/nodes/proxyShapePlugin.h>
 
+#include <pxr/base/work/loops.h>
+#include <pxr/base/work/threadLimits.h>
+#include <pxr/usd/usd/primRange.h>
+
 #include <maya/MProfiler.h>
+
+#include <algorithm>
+#include <iterator>
+
 namespace {
 const int _proxyShapeMetadataProfilerCategory = MProfiler::addCategory(
 #if MAYA_API_VERSION >= 20190000
@@ -38,6 +45,66 @@ namespace AL {
 namespace usdmaya {
 namespace nodes {
 
+namespace {
+
+//----------------------------------------------------------------------------------------------------------------------
+/// A subtree of the stage, and the prims tagged to be excluded from the proxy shape found in it.
+struct ExcludedTaggedSubtree
+{
+    UsdPrim       root;
+    SdfPathVector excluded;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+bool isExcludedTagged(const UsdPrim& prim)
+{
+    bool excludeGeo = false;
+    return prim.GetMetadata(Metadata::excludeFromProxyShape, &excludeGeo) && excludeGeo;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// Returns the sorted paths of the prims tagged to be excluded from the proxy shape, at and below
+/// the root prim. The top of the hierarchy is split into subtrees, which are scanned in parallel.
+/// As with a TransformIterator that stops on instances, the children of instances are not visited.
+SdfPathVector findExcludedTaggedPrims(const UsdPrim& root)
+{
+    SdfPathVector excluded;
+
+    // Split the top of the hierarchy until there are enough subtrees to keep all the threads
+    // busy, checking the prims that are split on the way.
+    const size_t                       minSubtrees = 8 * WorkGetConcurrencyLimit();
+    std::vector<ExcludedTaggedSubtree> subtrees { { root, {} } };
+    for (int depth = 0; depth < 4 && !subtrees.empty() && subtrees.size() < minSubtrees;
+         ++depth) {
+        std::vector<ExcludedTaggedSubtree> children;
+        for (const auto& subtree : subtrees) {
+            if (isExcludedTagged(subtree.root)) {
+                excluded.push_back(subtree.root.GetPath());
+            }
+            for (const UsdPrim& child : subtree.root.GetChildren()) {
+                children.push_back({ child, {} });
+            }
+        }
+        subtrees.swap(children);
+    }
+
+    WorkParallelForEach(subtrees.begin(), subtrees.end(), [](ExcludedTaggedSubtree& subtree) {
+        for (const UsdPrim& prim : UsdPrimRange(subtree.root)) {
+            if (isExcludedTagged(prim)) {
+                subtree.excluded.push_back(prim.GetPath());
+            }
+        }
+    });
+
+    for (const auto& subtree : subtrees) {
+        excluded.insert(excluded.end(), subtree.excluded.begin(), subtree.excluded.end());
+    }
+    std::sort(excluded.begin(), excluded.end());
+    return excluded;
+}
+
+} // namespace
+
 //----------------------------------------------------------------------------------------------------------------------
 void ProxyShape::processChangedMetaData(
     const SdfPathVector& resyncedPaths,
@@ -52,63 +119,52 @@ void ProxyShape::processChangedMetaData(
             resyncedPaths.size(),
             changedOnlyPaths.size());
 
-    bool excludedPrimsModified = false;
-    {
-        for (const SdfPath& resyncedPath : resyncedPaths) {
-            const UsdPrim syncPrimRoot = m_stage->GetPrimAtPath(resyncedPath);
-            if (!syncPrimRoot) {
-                // TODO : Ensure elements have been removed from selectabilityDB, excludeGeom, and
-                // lock prims
-                continue;
-            }
+    // The tagged prims are kept sorted, so that the prims of a resynced subtree are contiguous.
+    std::sort(m_excludedTaggedGeometry.begin(), m_excludedTaggedGeometry.end());
 
-            // sort the excluded tagged geom to help searching
-            std::sort(m_excludedTaggedGeometry.begin(), m_excludedTaggedGeometry.end());
-
-            // keep track of where the last item in the original set of prims is.
-            // As we traverse, lookups will be performed on the first elements in the array, so that
-            // will remain sorted. Items appended to the end of the array will not be sorted.
-            // In order to do this without using a 2nd vector, I'm using the lastTaggedPrim to
-            // denote the boundary between the sorted and unsorted prims
-            size_t lastTaggedPrim = m_excludedTaggedGeometry.size();
-
-            // from the resync prim, traverse downwards through the child prims
-            for (fileio::TransformIterator it(syncPrimRoot, parentTransform(), true); !it.done();
-                 it.next()) {
-                const auto& prim = it.prim();
-                const auto& path = prim.GetPath();
-
-                // first check to see if the excluded geom has changed
-                {
-                    bool excludeGeo = false;
-                    if (prim.GetMetadata(Metadata::excludeFromProxyShape, &excludeGeo)
-                        && excludeGeo) {
-                        const auto last = m_excludedTaggedGeometry.begin() + lastTaggedPrim;
-                        const auto geoIt
-                            = std::lower_bound(m_excludedTaggedGeometry.begin(), last, path);
-                        if (geoIt != last && *geoIt == path) {
-                            // we already have an entry for this prim
-                        } else {
-                            // add to back of list
-                            excludedPrimsModified = true;
-                            m_excludedTaggedGeometry.emplace_back(path);
-                        }
-                    } else {
-                        // if we aren't excluding the geom, but have an existing entry, remove it.
-                        const auto last = m_excludedTaggedGeometry.begin() + lastTaggedPrim;
-                        const auto geoIt
-                            = std::lower_bound(m_excludedTaggedGeometry.begin(), last, path);
-                        if (geoIt != last && *geoIt == path) {
-                            excludedPrimsModified = true;
-                            m_excludedTaggedGeometry.erase(geoIt);
-                            --lastTaggedPrim;
-                        }
-                    }
-                }
-            }
+    bool          excludedPrimsModified = false;
+    SdfPathVector untagged;
+    for (const SdfPath& resyncedPath : resyncedPaths) {
+        if (!resyncedPath.IsAbsoluteRootOrPrimPath()) {
+            continue;
+        }
+
+        // rescan the resynced subtree only. If its root prim has been removed, so have the
+        // tagged prims it contained.
+        const UsdPrim syncPrimRoot = m_stage->GetPrimAtPath(resyncedPath);
+        const SdfPathVector found
+            = syncPrimRoot ? findExcludedTaggedPrims(syncPrimRoot) : SdfPathVector();
+
+        const auto first = std::lower_bound(
+            m_excludedTaggedGeometry.begin(), m_excludedTaggedGeometry.end(), resyncedPath);
+        auto last = first;
+        while (last != m_excludedTaggedGeometry.end() && last->HasPrefix(resyncedPath)) {
+            ++last;
+        }
+
+        if (!std::equal(first, last, found.begin(), found.end())) {
+            excludedPrimsModified = true;
+            std::set_difference(
+                first, last, found.begin(), found.end(), std::back_inserter(untagged));
+            const auto inserted = m_excludedTaggedGeometry.erase(first, last);
+            m_excludedTaggedGeometry.insert(inserted, found.begin(), found.end());
         }
     }
 
+    // the excluded geometry keeps the previously excluded paths, so drop the prims which are no
+    // longer tagged (or no longer exist) from it too.
+    if (!untagged.empty()) {
+        std::sort(untagged.begin(), untagged.end());
+        m_excludedGeometry.erase(
+            std::remove_if(
+                m_excludedGeometry.begin(),
+                m_excludedGeometry.end(),
+                [&untagged](const SdfPath& path) {
+                    return std::binary_search(untagged.begin(), untagged.end(), path);
+                }),
+            m_excludedGeometry.end());
+    }
+
     // reconstruct the lock prims
     {
         constructLockPrims();
@@ -212,15 +268,7 @@ void ProxyShape::findPrimsWithMetaData()
     if (!m_stage)
         return;
 
-    for (fileio::TransformIterator it(m_stage, parentTransform(), true); !it.done(); it.next()) {
-        const auto& prim = it.prim();
-        bool        excludeGeo = false;
-        if (prim.GetMetadata(Metadata::excludeFromProxyShape, &excludeGeo)) {
-            if (excludeGeo) {
-                m_excludedTaggedGeometry.push_back(prim.GetPrimPath());
-            }
-        }
-    }
+    m_excludedTaggedGeometry = findExcludedTaggedPrims(m_stage->GetPseudoRoot());
 
     constructLockPrims();
     constructExcludedPrims();
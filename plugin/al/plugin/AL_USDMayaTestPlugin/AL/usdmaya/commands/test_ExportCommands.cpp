@@ -193,3 +193,57 @@ TEST(ExportCommands, extensiveAnimationCheck)
     MGlobal::executeCommand(exportCmd, true);
     expectAnimation(false);
 }
+
+TEST(ExportCommands, contextEvaluation)
+{
+    MFileIO::newFile(true);
+    MGlobal::executeCommand(
+        MString("polyCube -n cube;"
+                "setKeyframe -t 1 -v 0 -at tx cube;setKeyframe -t 10 -v 9 -at tx cube;"
+                "expression -s \"polyCube1.width = frame\";"
+                "currentTime 5;select cube;"),
+        false,
+        true);
+
+    const std::string timePath = buildTempPath("AL_USDMayaTests_contextEvaluationOff.usda");
+    const std::string contextPath = buildTempPath("AL_USDMayaTests_contextEvaluationOn.usda");
+
+    MString exportCmd;
+    exportCmd.format(
+        MString("AL_usdmaya_ExportCommand -f \"^1s\" -sl 1 -frameRange 1 10"),
+        AL::maya::utils::convert(timePath));
+    MGlobal::executeCommand(exportCmd, true);
+    exportCmd.format(
+        MString("AL_usdmaya_ExportCommand -f \"^1s\" -sl 1 -ce 1 -frameRange 1 10"),
+        AL::maya::utils::convert(contextPath));
+    MGlobal::executeCommand(exportCmd, true);
+
+    UsdStageRefPtr timeStage = UsdStage::Open(timePath);
+    UsdStageRefPtr contextStage = UsdStage::Open(contextPath);
+    ASSERT_TRUE(timeStage);
+    ASSERT_TRUE(contextStage);
+
+    UsdGeomMesh timeMesh(timeStage->GetPrimAtPath(SdfPath("/cube")));
+    UsdGeomMesh contextMesh(contextStage->GetPrimAtPath(SdfPath("/cube")));
+    ASSERT_TRUE(timeMesh);
+    ASSERT_TRUE(contextMesh);
+
+    bool                        resetsXformStack;
+    std::vector<UsdGeomXformOp> ops = contextMesh.GetOrderedXformOps(&resetsXformStack);
+    ASSERT_FALSE(ops.empty());
+    EXPECT_EQ(10u, ops[0].GetAttr().GetNumTimeSamples());
+    EXPECT_EQ(10u, contextMesh.GetPointsAttr().GetNumTimeSamples());
+
+    // The samples match the ones exported by changing the current time.
+    for (double t = 1.0; t <= 10.0; t += 1.0) {
+        GfMatrix4d timeMatrix, contextMatrix;
+        timeMesh.GetLocalTransformation(&timeMatrix, &resetsXformStack, t);
+        contextMesh.GetLocalTransformation(&contextMatrix, &resetsXformStack, t);
+        EXPECT_TRUE(GfIsClose(timeMatrix, contextMatrix, 1e-6));
+
+        VtArray<GfVec3f> timePoints, contextPoints;
+        timeMesh.GetPointsAttr().Get(&timePoints, t);
+        contextMesh.GetPointsAttr().Get(&contextPoints, t);
+        EXPECT_EQ(timePoints, contextPoints);
+    }
+}
@@ -0,0 +1,105 @@
+//
+// Copyright 2017 Animal Logic
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AL/usdmaya/Metadata.h"
+#include "AL/usdmaya/nodes/ProxyShape.h"
+#include "test_usdmaya.h"
+
+#include <pxr/usd/usd/stage.h>
+
+#include <maya/MFileIO.h>
+
+#include <algorithm>
+
+using AL::maya::test::buildTempPath;
+
+namespace {
+
+bool isExcluded(const MayaUsdProxyShapeBase* proxyShape, const char* const path)
+{
+    const SdfPathVector excluded = proxyShape->getExcludePrimPaths();
+    return std::find(excluded.begin(), excluded.end(), SdfPath(path)) != excluded.end();
+}
+
+} // namespace
+
+/*
+ * Test that the prims tagged to be excluded from the proxy shape follow the resyncs of their
+ * subtrees: retagged prims are picked up, and the tagged prims of removed subtrees are dropped.
+ */
+TEST(ProxyShapeMetaData, excludedTaggedPrimsOnResync)
+{
+    std::function<UsdStageRefPtr()> constructTransformChain = []() {
+        UsdStageRefPtr stage = UsdStage::CreateInMemory();
+        stage->DefinePrim(SdfPath("/A/B"));
+        stage->DefinePrim(SdfPath("/A/C/D"));
+        stage->DefinePrim(SdfPath("/E"));
+        for (const char* const path : { "/A/B", "/A/C/D", "/E" }) {
+            stage->GetPrimAtPath(SdfPath(path))
+                .SetMetadata(AL::usdmaya::Metadata::excludeFromProxyShape, true);
+        }
+        return stage;
+    };
+
+    MFileIO::newFile(true);
+    const std::string temp_path
+        = buildTempPath("AL_USDMayaTests_ProxyShapeMetaData_excludedTaggedPrimsOnResync.usda");
+    AL::usdmaya::nodes::ProxyShape* proxyShape
+        = CreateMayaProxyShape(constructTransformChain, temp_path);
+    UsdStageRefPtr stage = proxyShape->getUsdStage();
+
+    EXPECT_EQ(
+        SdfPathVector({ SdfPath("/A/B"), SdfPath("/A/C/D"), SdfPath("/E") }),
+        proxyShape->excludedTaggedGeometry());
+    EXPECT_TRUE(isExcluded(proxyShape, "/A/B"));
+    EXPECT_TRUE(isExcluded(proxyShape, "/A/C/D"));
+    EXPECT_TRUE(isExcluded(proxyShape, "/E"));
+
+    // Retag the prims of the /A subtree
+    stage->GetPrimAtPath(SdfPath("/A/B"))
+        .SetMetadata(AL::usdmaya::Metadata::excludeFromProxyShape, false);
+    stage->GetPrimAtPath(SdfPath("/A/C"))
+        .SetMetadata(AL::usdmaya::Metadata::excludeFromProxyShape, true);
+    proxyShape->processChangedMetaData({ SdfPath("/A") }, {});
+
+    EXPECT_EQ(
+        SdfPathVector({ SdfPath("/A/C"), SdfPath("/A/C/D"), SdfPath("/E") }),
+        proxyShape->excludedTaggedGeometry());
+    EXPECT_FALSE(isExcluded(proxyShape, "/A/B"));
+    EXPECT_TRUE(isExcluded(proxyShape, "/A/C"));
+    EXPECT_TRUE(isExcluded(proxyShape, "/A/C/D"));
+    EXPECT_TRUE(isExcluded(proxyShape, "/E"));
+
+    // A new tagged subtree is picked up without touching the others
+    stage->DefinePrim(SdfPath("/F/G"))
+        .SetMetadata(AL::usdmaya::Metadata::excludeFromProxyShape, true);
+    proxyShape->processChangedMetaData({ SdfPath("/F") }, {});
+
+    EXPECT_EQ(
+        SdfPathVector({ SdfPath("/A/C"), SdfPath("/A/C/D"), SdfPath("/E"), SdfPath("/F/G") }),
+        proxyShape->excludedTaggedGeometry());
+    EXPECT_TRUE(isExcluded(proxyShape, "/F/G"));
+
+    // Removing a subtree drops all the tagged prims it contained
+    stage->RemovePrim(SdfPath("/A/C"));
+    proxyShape->processChangedMetaData({ SdfPath("/A/C") }, {});
+
+    EXPECT_EQ(
+        SdfPathVector({ SdfPath("/E"), SdfPath("/F/G") }), proxyShape->excludedTaggedGeometry());
+    EXPECT_FALSE(isExcluded(proxyShape, "/A/C"));
+    EXPECT_FALSE(isExcluded(proxyShape, "/A/C/D"));
+    EXPECT_TRUE(isExcluded(proxyShape, "/E"));
+    EXPECT_TRUE(isExcluded(proxyShape, "/F/G"));
+}
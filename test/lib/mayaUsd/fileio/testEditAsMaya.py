@@ -81,6 +81,30 @@ class EditAsMayaTestCase(unittest.TestCase):
             self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
             self.assertFalse(mayaUsd.lib.PrimUpdaterManager.editAsMaya(aUsdUfePathStr))
 
+    def testCanEditAsMayaAnAncestorAfterUndoAndMerge(self):
+        '''Test that the edited descendants of an ancestor follow undo, redo and merge.'''
+
+        (ps, aXlateOp, aXlation, aUsdUfePathStr, aUsdUfePath, aUsdItem,
+             bXlateOp, bXlation, bUsdUfePathStr, bUsdUfePath, bUsdItem) = createSimpleXformScene()
+
+        # Edit "B" Prim as Maya data: neither it nor its ancestor "A" can be edited.
+        cmds.mayaUsdEditAsMaya(bUsdUfePathStr)
+        self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
+        self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(bUsdUfePathStr))
+
+        cmds.undo()
+        self.assertTrue(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
+        self.assertTrue(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(bUsdUfePathStr))
+
+        cmds.redo()
+        self.assertFalse(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
+
+        # Once merged, "A" can be edited again.
+        bMayaPathStr = ufe.PathString.string(ufe.GlobalSelection.get().front().path())
+        with mayaUsd.lib.OpUndoItemList():
+            self.assertTrue(mayaUsd.lib.PrimUpdaterManager.mergeToUsd(bMayaPathStr))
+        self.assertTrue(mayaUsd.lib.PrimUpdaterManager.canEditAsMaya(aUsdUfePathStr))
+
     @unittest.skipIf(os.getenv('HAS_ORPHANED_NODES_MANAGER', '0') != '1', 'Test only available when UFE supports the orphaned nodes manager')
     def testRenameAncestorOfEditAsMaya(self):
         '''Test that renaming an ancestor correctly updates the internal data.'''
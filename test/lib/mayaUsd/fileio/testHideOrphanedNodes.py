@@ -31,6 +31,7 @@ from maya.api import OpenMaya as om
  
 import ufe
 
+import json
 import os.path
 import unittest
 
@@ -291,6 +292,58 @@ class HideOrphanedNodesTestCase(unittest.TestCase):
         cMayaPathStr = mayaUsd.lib.PrimUpdaterManager.readPullInformation(cPrim)
         self.assertNotEqual(cMayaPathStr, '')
 
+    def _findPulledStates(self, stateJson):
+        '''Return the JSON state of each pulled prim, keyed by its prim name.'''
+        states = {}
+        for key, value in stateJson.items():
+            if key.startswith('/') and isinstance(value, dict):
+                if 'pull info' in value:
+                    states[key[1:]] = value
+                states.update(self._findPulledStates(value))
+        return states
+
+    def testSavedOrphanedState(self):
+        # Pull on C and E, then orphan C by switching the variant of B.
+        pullParentVisibilityPlug, mayaPaths = self.pullAndGetParentVisibility(
+            [self.cPathStr, self.ePathStr])
+        cPrim = mayaUsd.ufe.ufePathToPrim(self.cPathStr)
+        cPrim.GetParent().GetVariantSet('cdVariant').SetVariantSelection('d')
+        self.assertFalse(pullParentVisibilityPlug[self.cPathStr].asBool())
+        self.assertTrue(pullParentVisibilityPlug[self.ePathStr].asBool())
+
+        # Only the orphaned pulled prim is saved with the orphaned key.
+        cmds.optionVar(intValue=('mayaUsd_SerializedUsdEditsLocation', 2))
+        filename = os.path.abspath("orphanedState.ma")
+        self._saveScene(filename)
+
+        states = self._findPulledStates(
+            json.loads(cmds.getAttr('|__mayaUsd__.orphanedNodeManagerState')))
+        self.assertEqual(sorted(states.keys()), ['C', 'E'])
+        self.assertTrue(states['C'].get('orphaned', False))
+        self.assertNotIn('orphaned', states['E'])
+
+        # Flag E as orphaned in the saved state, although its pull parent is
+        # visible, as a stale state would.
+        with open(filename, 'r') as f:
+            sceneText = f.read()
+        visibleE = '\\"/E\\":{\\"pull info\\"'
+        self.assertIn(visibleE, sceneText)
+        sceneText = sceneText.replace(
+            visibleE, '\\"/E\\":{\\"orphaned\\":true,\\"pull info\\"')
+        with open(filename, 'w') as f:
+            f.write(sceneText)
+
+        self._reloadScene(filename)
+        pullParentVisibilityPlug = self.getVisibilityPlugs(mayaPaths)
+        self.assertFalse(pullParentVisibilityPlug[self.cPathStr].asBool())
+        self.assertTrue(pullParentVisibilityPlug[self.ePathStr].asBool())
+
+        # The state is synchronized with the pull parents on load, so deleting
+        # the proxy shape hides E.
+        cmds.delete(self.ps)
+        self.assertFalse(pullParentVisibilityPlug[self.cPathStr].asBool())
+        self.assertFalse(pullParentVisibilityPlug[self.ePathStr].asBool())
+
     def testHideOnNestingVariantSwitch(self):
         # Pull on C and E.
         pullParentVisibilityPlug, _ = self.pullAndGetParentVisibility(
@@ -159,6 +159,49 @@ class testLayerManagerSerialization(unittest.TestCase):
 
         shutil.rmtree(self._currentTestDir)
 
+    @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 2, 'testSaveAllToMayaBinary is available only in UFE v2 or greater.')
+    def testSaveAllToMayaBinary(self):
+        '''
+        Verify that all USD edits are saved into the Maya file as compressed crate data.
+        '''
+        stage = self.copyTestFilesAndMakeEdits()
+
+        # Time samples are what makes the text serialization slow and large.
+        stage.SetEditTarget(stage.GetSessionLayer())
+        attr = stage.GetPrimAtPath("/ChangeInSessionLayer").CreateAttribute(
+            "samples", Sdf.ValueTypeNames.Float)
+        for frame in range(1000):
+            attr.Set(float(frame), frame)
+
+        cmds.optionVar(intValue=('mayaUsd_SerializedUsdEditsLocation', 2))
+        cmds.optionVar(intValue=('mayaUsd_SerializedUsdEditsBinary', 1))
+
+        cmds.file(save=True, force=True)
+        cmds.file(new=True, force=True)
+
+        with open(self._tempMayaFile) as mayaFile:
+            self.assertIn('#usdc_lz4', mayaFile.read())
+
+        cmds.file(self._tempMayaFile, open=True)
+
+        stage = mayaUsd.ufe.getStage(
+            "|SerializationTest|SerializationTestShape")
+        stack = stage.GetLayerStack()
+        self.assertEqual(6, len(stack))
+
+        self.assertTrue(stage.GetPrimAtPath("/ChangeInRoot"))
+        self.assertTrue(stage.GetPrimAtPath("/ChangeInLayer_1_1"))
+        self.assertTrue(stage.GetPrimAtPath("/ChangeInSessionLayer"))
+
+        attr = stage.GetAttributeAtPath("/ChangeInSessionLayer.samples")
+        self.assertEqual(1000, attr.GetNumTimeSamples())
+        self.assertEqual(500.0, attr.Get(500))
+
+        cmds.optionVar(remove='mayaUsd_SerializedUsdEditsBinary')
+        self.confirmEditsSavedStatus(False, False)
+
+        shutil.rmtree(self._currentTestDir)
+
     @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 2, 'testSaveAllToUsd is available only in UFE v2 or greater.')
     def testSaveAllToUsd(self):
         '''
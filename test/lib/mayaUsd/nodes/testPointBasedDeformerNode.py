@@ -110,6 +110,50 @@ class testPointBasedDeformerNode(unittest.TestCase):
         self._ValidateControlPoint(testCube, 2, Gf.Vec3d(-1.0, 0.0, 1.0))
         self._ValidateControlPoint(testCube, 3, Gf.Vec3d(0.0, 1.0, 1.0))
 
+    def testCubeWithDeformerStepping(self):
+        """
+        Tests that stepping through the frames in either direction, which reads
+        the upcoming samples ahead, deforms the mesh with the sample of the
+        current frame.
+        """
+        timeUnit = OM.MTime.uiUnit()
+        OMA.MAnimControl.setAnimationStartEndTime(
+            OM.MTime(self.START_TIMECODE, timeUnit), OM.MTime(self.END_TIMECODE, timeUnit))
+
+        testCube = cmds.polyCube(depth=1.0, height=1.0, width=1.0)[0]
+
+        stageNode = cmds.createNode('pxrUsdStageNode')
+        cmds.setAttr('%s.filePath' % stageNode, self._deformingCubeUsdFilePath,
+            type='string')
+
+        cmds.select(testCube, replace=True)
+        deformerNode = cmds.deformer(type='pxrUsdPointBasedDeformerNode')[0]
+        cmds.setAttr('%s.primPath' % deformerNode, self._deformingCubePrimPath,
+            type='string')
+        cmds.connectAttr('%s.outUsdStage' % stageNode,
+            '%s.inUsdStage' % deformerNode)
+        cmds.connectAttr('time1.outTime', '%s.time' % deformerNode)
+
+        # Step forward to the middle of the frame range.
+        for frame in range(int(self.START_TIMECODE), int(self.MID_TIMECODE) + 1):
+            cmds.currentTime(frame)
+            cmds.getAttr('%s.controlPoints[0].xValue' % testCube)
+
+        self._ValidateControlPoint(testCube, 0, Gf.Vec3d(0.0, -1.0, 1.0))
+        self._ValidateControlPoint(testCube, 1, Gf.Vec3d(1.0, 0.0, 1.0))
+        self._ValidateControlPoint(testCube, 2, Gf.Vec3d(-1.0, 0.0, 1.0))
+        self._ValidateControlPoint(testCube, 3, Gf.Vec3d(0.0, 1.0, 1.0))
+
+        # Step backward to the start of the frame range.
+        for frame in range(int(self.MID_TIMECODE), int(self.START_TIMECODE) - 1, -1):
+            cmds.currentTime(frame)
+            cmds.getAttr('%s.controlPoints[0].xValue' % testCube)
+
+        self._ValidateControlPoint(testCube, 0, Gf.Vec3d(-1.0, -1.0, 1.0))
+        self._ValidateControlPoint(testCube, 1, Gf.Vec3d(1.0, -1.0, 1.0))
+        self._ValidateControlPoint(testCube, 2, Gf.Vec3d(-1.0, 1.0, 1.0))
+        self._ValidateControlPoint(testCube, 3, Gf.Vec3d(1.0, 1.0, 1.0))
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -17,7 +17,7 @@
 
 from maya import cmds
 from maya import standalone
-from pxr import Usd, Sdf, UsdUtils
+from pxr import Usd, Sdf, UsdGeom, UsdUtils
 
 import fixturesUtils
 import mayaUsd_createStageWithNewLayer
@@ -62,6 +62,40 @@ class testProxyShapeBase(unittest.TestCase):
         bboxSize = cmds.getAttr('Cube_usd.boundingBoxSize')[0]
         self.assertEqual(bboxSize, (1.0, 1.0, 1.0))
 
+    def testBoundingBoxIncrementalUpdate(self):
+        '''Verify that the cached bounding box follows edits to a part of the stage.'''
+        cmds.file(new=True, force=True)
+
+        proxyShape = mayaUsd_createStageWithNewLayer.createStageWithNewLayer()
+        stage = mayaUsd.lib.GetPrim(proxyShape).GetStage()
+
+        cubes = []
+        for i in range(3):
+            xform = UsdGeom.Xform.Define(stage, '/Group%d' % i)
+            cube = UsdGeom.Cube.Define(stage, '/Group%d/Cube' % i)
+            cube.CreateExtentAttr([(-1, -1, -1), (1, 1, 1)])
+            xform.AddTranslateOp().Set((3.0 * i, 0.0, 0.0))
+            cubes.append(cube)
+
+        self.assertEqual(cmds.getAttr(proxyShape + '.boundingBoxSize')[0], (8.0, 2.0, 2.0))
+
+        # Growing a single cube only affects the part of the stage containing it.
+        cubes[1].GetExtentAttr().Set([(-1, -1, -1), (1, 4, 1)])
+        self.assertEqual(cmds.getAttr(proxyShape + '.boundingBoxSize')[0], (8.0, 5.0, 2.0))
+
+        # Removing a group removes its contribution.
+        stage.RemovePrim('/Group2')
+        self.assertEqual(cmds.getAttr(proxyShape + '.boundingBoxSize')[0], (5.0, 5.0, 2.0))
+
+        # Animated transforms are evaluated per time.
+        translateOp = UsdGeom.Xform.Get(stage, '/Group0').GetOrderedXformOps()[0]
+        translateOp.Set((0.0, 0.0, 0.0), 1.0)
+        translateOp.Set((0.0, 0.0, -10.0), 10.0)
+        cmds.currentTime(1)
+        self.assertEqual(cmds.getAttr(proxyShape + '.boundingBoxSize')[0], (5.0, 5.0, 2.0))
+        cmds.currentTime(10)
+        self.assertEqual(cmds.getAttr(proxyShape + '.boundingBoxSize')[0], (5.0, 5.0, 12.0))
+
     @unittest.skipUnless(ufeUtils.ufeFeatureSetVersion() >= 2, 'testDuplicateProxyStageAnonymous only available in UFE v2 or greater.')
     def testDuplicateProxyStageAnonymous(self):
         '''
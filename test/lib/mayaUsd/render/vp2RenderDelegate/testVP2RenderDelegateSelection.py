@@ -149,6 +149,50 @@ class testVP2RenderDelegateSelection(imageUtils.ImageDiffingTestCase):
         cmds.modelEditor('modelPanel4', e=True, wireframeOnShaded=False, displayLights='default')
         self._selectionTest('', usdCube, usdCylinder, proxyDagPath, 'wireframe')
 
+    def _setUpSmoothShadedSelection(self):
+        cmds.file(force=True, new=True)
+        mayaUtils.loadPlugin("mayaUsdPlugin")
+        usdaFile = testUtils.getTestScene("setsCmd", "5prims.usda")
+        proxyDagPath, stage = mayaUtils.createProxyFromFile(usdaFile)
+
+        cmds.move(-4, -24, 0, "persp")
+        cmds.rotate(90, 0, 0, "persp")
+
+        cmds.modelEditor('modelPanel4', e=True, displayAppearance='smoothShaded', displayLights='default')
+        cmds.modelEditor('modelPanel4', e=True, wireframeOnShaded=False, displayLights='default')
+        return proxyDagPath, stage
+
+    def testLargeSelection(self):
+        proxyDagPath, stage = self._setUpSmoothShadedSelection()
+
+        # Transforms without geometry do not draw, but their number makes the selection change
+        # too large to be tracked per item.
+        emptyItems = []
+        for i in range(1100):
+            stage.DefinePrim('/Empty/Xform%d' % i, 'Xform')
+            emptyItems.append(proxyDagPath + ",/Empty/Xform%d" % i)
+        cmds.select(clear=True)
+        cmds.refresh(force=True)
+
+        # The cube is the lead item, and must be highlighted.
+        cmds.select(emptyItems + [proxyDagPath + ",/Cube1"])
+        self.assertSnapshotClose('objectA_smoothShaded.png')
+
+        cmds.select(clear=True)
+        self.assertSnapshotClose('clear_smoothShaded.png')
+
+    def testSelectionAfterSceneEdit(self):
+        proxyDagPath, stage = self._setUpSmoothShadedSelection()
+
+        cmds.select(proxyDagPath + ",/Cylinder1")
+        cmds.refresh(force=True)
+
+        # Adding an rprim changes the scene state, which drops the selection kept per item. The
+        # mesh has no points, so it does not draw.
+        stage.DefinePrim('/EmptyMesh', 'Mesh')
+        cmds.select(proxyDagPath + ",/Cube1")
+        self.assertSnapshotClose('objectA_smoothShaded.png')
+
     def testInstancedSelection(self):
         cmds.file(force=True, new=True)
         mayaUtils.loadPlugin("mayaUsdPlugin")
@@ -142,3 +142,44 @@ class TestUsdUndoManager(unittest.TestCase):
         self.assertTrue(stage.GetPrimAtPath('/TreeBase'))
         self.assertTrue(stage.GetPrimAtPath('/TreeBase/leavesXform/leaves'))
         self.assertTrue(stage.GetPrimAtPath('/TreeBase/trunk'))
+
+    def testCoalescedFieldEdits(self):
+        '''
+            Repeated writes of the same field or time sample inside a block
+            are undone and redone as a single edit.
+        '''
+        # start with a new file
+        cmds.file(force=True, new=True)
+
+        with mayaUsdLib.UsdUndoBlock():
+            prim = self.stage.DefinePrim('/World', 'Sphere')
+            radius = prim.GetAttribute('radius')
+            radius.Set(1.0)
+            radius.Set(2.0, 1.0)
+
+        with mayaUsdLib.UsdUndoBlock():
+            for i in range(100):
+                radius.Set(10.0 + i)
+                radius.Set(20.0 + i, 1.0)
+                radius.Set(30.0 + i, 2.0)
+            # a structural edit ends the coalescing
+            self.stage.DefinePrim('/World/Child')
+            radius.Set(50.0)
+
+        self.assertEqual(radius.Get(), 50.0)
+        self.assertEqual(radius.Get(1.0), 119.0)
+        self.assertEqual(radius.Get(2.0), 129.0)
+
+        cmds.undo()
+
+        self.assertEqual(radius.Get(), 1.0)
+        self.assertEqual(radius.Get(1.0), 2.0)
+        self.assertEqual(radius.GetTimeSamples(), [1.0])
+        self.assertFalse(self.stage.GetPrimAtPath('/World/Child'))
+
+        cmds.redo()
+
+        self.assertEqual(radius.Get(), 50.0)
+        self.assertEqual(radius.Get(1.0), 119.0)
+        self.assertEqual(radius.Get(2.0), 129.0)
+        self.assertTrue(self.stage.GetPrimAtPath('/World/Child'))
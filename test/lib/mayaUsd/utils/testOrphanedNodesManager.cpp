@@ -0,0 +1,92 @@
+#include <mayaUsd/fileio/orphanedNodesManager.h>
+
+#include <ufe/path.h>
+#include <ufe/pathSegment.h>
+
+#include <gtest/gtest.h>
+
+using PulledPrims = MayaUsd::OrphanedNodesManager::PulledPrims;
+using PullVariantInfo = MayaUsd::OrphanedNodesManager::PullVariantInfo;
+
+namespace {
+
+// The trie only uses the path components, so the run-time IDs do not matter.
+Ufe::Path stagePath() { return Ufe::Path(Ufe::PathSegment("|stage1|stageShape1", 1, '|')); }
+
+Ufe::Path primPath(const char* usdPath)
+{
+    return stagePath() + Ufe::PathSegment(usdPath, 2, '/');
+}
+
+PulledPrims pulledPrims()
+{
+    PulledPrims prims;
+    prims.add(primPath("/A/B/C"), PullVariantInfo());
+    prims.add(primPath("/D/E"), PullVariantInfo());
+    return prims;
+}
+
+} // namespace
+
+TEST(OrphanedNodesManager, pulledPrimsCounts)
+{
+    PulledPrims prims = pulledPrims();
+    EXPECT_EQ(prims.root()->nbPulled(), 2u);
+    EXPECT_EQ(prims.root()->nbOrphaned(), 0u);
+
+    EXPECT_TRUE(prims.setOrphaned(primPath("/A/B/C"), true));
+    EXPECT_EQ(prims.root()->nbOrphaned(), 1u);
+    EXPECT_EQ(prims.node(primPath("/A"))->nbPulled(), 1u);
+    EXPECT_EQ(prims.node(primPath("/A"))->nbOrphaned(), 1u);
+    EXPECT_EQ(prims.node(primPath("/D"))->nbPulled(), 1u);
+    EXPECT_EQ(prims.node(primPath("/D"))->nbOrphaned(), 0u);
+
+    // Setting the same state again does not change the counts.
+    EXPECT_TRUE(prims.setOrphaned(primPath("/A/B/C"), true));
+    EXPECT_EQ(prims.root()->nbOrphaned(), 1u);
+
+    EXPECT_TRUE(prims.containsDescendant(stagePath()));
+    EXPECT_TRUE(prims.containsDescendantInclusive(primPath("/D/E")));
+    EXPECT_FALSE(prims.containsDescendant(primPath("/D/E")));
+
+    // Removing a pulled prim removes its counts and its empty ancestors.
+    EXPECT_TRUE(prims.remove(primPath("/A/B/C")));
+    EXPECT_EQ(prims.root()->nbPulled(), 1u);
+    EXPECT_EQ(prims.root()->nbOrphaned(), 0u);
+    EXPECT_FALSE(prims.node(primPath("/A")));
+
+    // Moving a subtree moves its counts.
+    EXPECT_TRUE(prims.setOrphaned(primPath("/D/E"), true));
+    EXPECT_TRUE(prims.move(primPath("/D"), primPath("/F")));
+    EXPECT_FALSE(prims.node(primPath("/D")));
+    EXPECT_EQ(prims.node(primPath("/F"))->nbPulled(), 1u);
+    EXPECT_EQ(prims.node(primPath("/F"))->nbOrphaned(), 1u);
+    EXPECT_EQ(prims.root()->nbPulled(), 1u);
+    EXPECT_EQ(prims.root()->nbOrphaned(), 1u);
+}
+
+TEST(OrphanedNodesManager, pulledPrimsCopiesShareNodes)
+{
+    const PulledPrims original = pulledPrims();
+
+    PulledPrims copy = original;
+    EXPECT_EQ(copy.root(), original.root());
+
+    // Modifying the copy only copies the nodes along the modified path.
+    EXPECT_TRUE(copy.setOrphaned(primPath("/A/B/C"), true));
+    EXPECT_NE(copy.root(), original.root());
+    EXPECT_NE(copy.node(primPath("/A/B/C")), original.node(primPath("/A/B/C")));
+    EXPECT_EQ(copy.node(primPath("/D")), original.node(primPath("/D")));
+
+    EXPECT_TRUE(copy.find(primPath("/A/B/C"))->isOrphaned());
+    EXPECT_FALSE(original.find(primPath("/A/B/C"))->isOrphaned());
+    EXPECT_EQ(copy.root()->nbOrphaned(), 1u);
+    EXPECT_EQ(original.root()->nbOrphaned(), 0u);
+
+    // Removing from the copy leaves the original whole.
+    EXPECT_TRUE(copy.remove(primPath("/D/E")));
+    EXPECT_FALSE(copy.node(primPath("/D")));
+    EXPECT_TRUE(original.find(primPath("/D/E")));
+    EXPECT_EQ(copy.root()->nbPulled(), 1u);
+    EXPECT_EQ(original.root()->nbPulled(), 2u);
+}
@@ -0,0 +1,179 @@
+#!/usr/bin/env mayapy
+#
+# Copyright 2024 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import mayaUsd.lib as mayaUsdLib
+
+from maya import standalone
+
+from pxr import Gf, Sdf, Usd, UsdGeom
+
+import fixturesUtils
+
+import unittest
+
+
+class testStageRayIntersector(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.setUpClass(__file__)
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def _CreateGrid(self, stage, path, size):
+        '''Creates a size x size unit grid in the XZ plane, centered on the origin.'''
+        mesh = UsdGeom.Mesh.Define(stage, path)
+        points = []
+        for z in range(size + 1):
+            for x in range(size + 1):
+                points.append(Gf.Vec3f(x - size / 2.0, 0.0, z - size / 2.0))
+        indices = []
+        for z in range(size):
+            for x in range(size):
+                first = z * (size + 1) + x
+                indices.extend([first, first + size + 1, first + size + 2, first + 1])
+        mesh.CreatePointsAttr(points)
+        mesh.CreateFaceVertexCountsAttr([4] * (size * size))
+        mesh.CreateFaceVertexIndicesAttr(indices)
+        return mesh
+
+    def setUp(self):
+        self.stage = Usd.Stage.CreateInMemory()
+        self.root = self.stage.GetPseudoRoot()
+        self.purposes = [UsdGeom.Tokens.default_]
+
+    def testIntersectRay(self):
+        '''Rays hit the closest mesh, in the space of the root.'''
+        ground = self._CreateGrid(self.stage, '/Ground', 10)
+        shelf = self._CreateGrid(self.stage, '/Shelf', 2)
+        UsdGeom.XformCommonAPI(shelf).SetTranslate((0.0, 3.0, 0.0))
+
+        intersector = mayaUsdLib.StageRayIntersector()
+        down = Gf.Ray(Gf.Vec3d(0.5, 10.0, 0.5), Gf.Vec3d(0.0, -1.0, 0.0))
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, down)
+        self.assertIsNotNone(hit)
+        self.assertEqual(hit.primPath, Sdf.Path('/Shelf'))
+        self.assertTrue(Gf.IsClose(hit.point, Gf.Vec3d(0.5, 3.0, 0.5), 1e-6))
+        self.assertTrue(Gf.IsClose(hit.normal, Gf.Vec3d(0.0, 1.0, 0.0), 1e-6))
+        self.assertAlmostEqual(hit.distance, 7.0)
+
+        # Beside the shelf, the ray hits the ground.
+        down = Gf.Ray(Gf.Vec3d(4.0, 10.0, 4.0), Gf.Vec3d(0.0, -1.0, 0.0))
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, down)
+        self.assertEqual(hit.primPath, Sdf.Path('/Ground'))
+
+        # Invisible meshes, and meshes with other purposes, are ignored.
+        UsdGeom.Imageable(shelf).MakeInvisible()
+        intersector.Clear()
+        down = Gf.Ray(Gf.Vec3d(0.5, 10.0, 0.5), Gf.Vec3d(0.0, -1.0, 0.0))
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, down)
+        self.assertEqual(hit.primPath, Sdf.Path('/Ground'))
+
+        ground.CreatePurposeAttr(UsdGeom.Tokens.guide)
+        intersector.Clear()
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, down)
+        self.assertIsNone(hit)
+
+    def testExcludePrimPaths(self):
+        '''The subtrees of the excluded prims are ignored.'''
+        self._CreateGrid(self.stage, '/Ground', 10)
+        shelf = self._CreateGrid(self.stage, '/Shelves/Shelf', 2)
+        UsdGeom.XformCommonAPI(shelf).SetTranslate((0.0, 3.0, 0.0))
+
+        intersector = mayaUsdLib.StageRayIntersector()
+        down = Gf.Ray(Gf.Vec3d(0.5, 10.0, 0.5), Gf.Vec3d(0.0, -1.0, 0.0))
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, down)
+        self.assertEqual(hit.primPath, Sdf.Path('/Shelves/Shelf'))
+
+        intersector.SetExcludePrimPaths([Sdf.Path('/Shelves')])
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, down)
+        self.assertEqual(hit.primPath, Sdf.Path('/Ground'))
+
+        intersector.SetExcludePrimPaths([])
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, down)
+        self.assertEqual(hit.primPath, Sdf.Path('/Shelves/Shelf'))
+
+    def testAxisAlignedRays(self):
+        '''Rays with zero direction components only hit within the slabs of these axes.'''
+        wall = self._CreateGrid(self.stage, '/Wall', 2)
+        UsdGeom.XformCommonAPI(wall).SetRotate((0.0, 0.0, 90.0))
+        UsdGeom.XformCommonAPI(wall).SetTranslate((5.0, 0.0, 0.0))
+
+        intersector = mayaUsdLib.StageRayIntersector()
+        right = Gf.Ray(Gf.Vec3d(0.0, 0.5, 0.5), Gf.Vec3d(1.0, 0.0, 0.0))
+        hit = intersector.IntersectRay(self.root, Usd.TimeCode.Default(), self.purposes, right)
+        self.assertIsNotNone(hit)
+        self.assertTrue(Gf.IsClose(hit.point, Gf.Vec3d(5.0, 0.5, 0.5), 1e-6))
+
+        # Rays starting on the sides of the bounds, or beside them, miss.
+        for origin in [(0.0, 1.0, 2.0), (0.0, 2.0, 0.5), (0.0, 0.5, -1.5)]:
+            right = Gf.Ray(Gf.Vec3d(*origin), Gf.Vec3d(1.0, 0.0, 0.0))
+            self.assertIsNone(intersector.IntersectRay(
+                self.root, Usd.TimeCode.Default(), self.purposes, right))
+
+    def testAnimatedTransform(self):
+        '''The top level of the hierarchy follows the time.'''
+        ground = self._CreateGrid(self.stage, '/Ground', 2)
+        translateOp = ground.AddTranslateOp()
+        translateOp.Set(Gf.Vec3d(0.0, 0.0, 0.0), 1.0)
+        translateOp.Set(Gf.Vec3d(0.0, 5.0, 0.0), 2.0)
+
+        intersector = mayaUsdLib.StageRayIntersector()
+        down = Gf.Ray(Gf.Vec3d(0.0, 10.0, 0.0), Gf.Vec3d(0.0, -1.0, 0.0))
+        for frame, height in [(1.0, 0.0), (2.0, 5.0), (1.0, 0.0)]:
+            hit = intersector.IntersectRay(self.root, frame, self.purposes, down)
+            self.assertAlmostEqual(hit.point[1], height)
+
+    def testFindClosestPoint(self):
+        '''The closest point accounts for the transforms of the meshes.'''
+        ground = self._CreateGrid(self.stage, '/Ground', 2)
+        UsdGeom.XformCommonAPI(ground).SetScale((10.0, 1.0, 10.0))
+
+        intersector = mayaUsdLib.StageRayIntersector()
+        hit = intersector.FindClosestPoint(
+            self.root, Usd.TimeCode.Default(), self.purposes, Gf.Vec3d(3.0, 2.0, -4.0))
+        self.assertTrue(Gf.IsClose(hit.point, Gf.Vec3d(3.0, 0.0, -4.0), 1e-6))
+        self.assertAlmostEqual(hit.distance, 2.0)
+
+        hit = intersector.FindClosestPoint(
+            self.root, Usd.TimeCode.Default(), self.purposes, Gf.Vec3d(3.0, 2.0, -4.0),
+            maxDistance=1.0)
+        self.assertIsNone(hit)
+
+    def testIntersectRays(self):
+        '''Batches of rays are intersected together, for example to scatter on a ground.'''
+        self._CreateGrid(self.stage, '/Ground', 200)
+
+        rays = []
+        for z in range(200):
+            for x in range(200):
+                rays.append(Gf.Ray(Gf.Vec3d(x - 99.5, 10.0, z - 99.5), Gf.Vec3d(0.0, -1.0, 0.0)))
+        rays.append(Gf.Ray(Gf.Vec3d(500.0, 10.0, 0.0), Gf.Vec3d(0.0, -1.0, 0.0)))
+
+        intersector = mayaUsdLib.StageRayIntersector()
+        hits = intersector.IntersectRays(self.root, Usd.TimeCode.Default(), self.purposes, rays)
+
+        self.assertEqual(len(hits), len(rays))
+        self.assertIsNone(hits[-1])
+        self.assertTrue(all(hit is not None for hit in hits[:-1]))
+        self.assertTrue(all(abs(hit.point[1]) < 1e-6 for hit in hits[:-1]))
+
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -0,0 +1,129 @@
+#!/usr/bin/env python
+
+#
+# Copyright 2023 Autodesk
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import fixturesUtils
+import mayaUtils
+
+from pxr import Sdf
+
+from maya import cmds
+from maya import standalone
+
+import usdUfe
+
+import ufe
+
+import timeit
+import unittest
+
+class AttributeObserver(ufe.Observer):
+    def __init__(self):
+        super(AttributeObserver, self).__init__()
+        self.valueChanged = 0
+
+    def __call__(self, notification):
+        if isinstance(notification, ufe.AttributeValueChanged):
+            self.valueChanged += 1
+
+class SceneObserver(ufe.Observer):
+    def __init__(self):
+        super(SceneObserver, self).__init__()
+        self.subtreeInvalidate = 0
+
+    def __call__(self, notification):
+        if isinstance(notification, ufe.SubtreeInvalidate):
+            self.subtreeInvalidate += 1
+
+class AttributeChangedNotificationGuardTestCase(unittest.TestCase):
+    '''Verify the attribute changed notification guard, and time large batched edits.'''
+
+    pluginsLoaded = False
+
+    # Number of attributes changed in a batch.
+    numAttributes = 5000
+
+    @classmethod
+    def setUpClass(cls):
+        fixturesUtils.readOnlySetUpClass(__file__, loadPlugin=False)
+
+        if not cls.pluginsLoaded:
+            cls.pluginsLoaded = mayaUtils.isMayaUsdPluginLoaded()
+
+    @classmethod
+    def tearDownClass(cls):
+        standalone.uninitialize()
+
+    def setUp(self):
+        self.assertTrue(self.pluginsLoaded)
+
+        cmds.file(new=True, force=True)
+
+        _, self.stage = mayaUtils.createProxyAndStage()
+        prim = self.stage.DefinePrim('/Prim', 'Xform')
+        self.attrs = [
+            prim.CreateAttribute('attr%d' % i, Sdf.ValueTypeNames.Float)
+            for i in range(self.numAttributes)]
+
+        self.attrObserver = AttributeObserver()
+        self.sceneObserver = SceneObserver()
+        ufe.Attributes.addObserver(self.attrObserver)
+        ufe.Scene.addObserver(self.sceneObserver)
+
+    def tearDown(self):
+        ufe.Attributes.removeObserver(self.attrObserver)
+        ufe.Scene.removeObserver(self.sceneObserver)
+
+    def _setAllAttributes(self, value):
+        for attr in self.attrs:
+            attr.Set(value)
+
+    def testCollapseDuplicates(self):
+        '''Repeated value changes to an attribute send a single notification.'''
+        start = timeit.default_timer()
+        with usdUfe.AttributeChangedNotificationGuard():
+            self._setAllAttributes(1.0)
+            self._setAllAttributes(2.0)
+        elapsed = timeit.default_timer() - start
+
+        print('Guarded %d attribute changes in %.3f s' % (2 * self.numAttributes, elapsed))
+
+        self.assertEqual(self.attrObserver.valueChanged, self.numAttributes)
+        self.assertEqual(self.sceneObserver.subtreeInvalidate, 0)
+
+    def testCoalesceIntoSubtreeInvalidate(self):
+        '''Value changes above the coalescing threshold send a subtree invalidate.'''
+        start = timeit.default_timer()
+        with usdUfe.AttributeChangedNotificationGuard(100):
+            self._setAllAttributes(1.0)
+        elapsed = timeit.default_timer() - start
+
+        print('Coalesced %d attribute changes in %.3f s' % (self.numAttributes, elapsed))
+
+        self.assertEqual(self.attrObserver.valueChanged, 0)
+        self.assertEqual(self.sceneObserver.subtreeInvalidate, 1)
+
+    def testBelowCoalescingThreshold(self):
+        '''Value changes below the coalescing threshold are sent individually.'''
+        with usdUfe.AttributeChangedNotificationGuard(self.numAttributes):
+            self._setAllAttributes(1.0)
+
+        self.assertEqual(self.attrObserver.valueChanged, self.numAttributes)
+        self.assertEqual(self.sceneObserver.subtreeInvalidate, 0)
+
+if __name__ == '__main__':
+    unittest.main(verbosity=2)
@@ -323,6 +323,58 @@ class EditRoutingTestCase(unittest.TestCase):
         except Exception:
             self.assertFalse(True, "Should have been able to create a command")
 
+    def testEditRouterCache(self):
+        '''
+        Test that the edit router cache only calls the edit router again after
+        the edit target changes or an edit router is registered.
+        '''
+        import usdUfe
+
+        prim = mayaUsd.ufe.ufePathToPrim("|stage1|stageShape1,/B")
+        stage = prim.GetStage()
+        sessionLayer = stage.GetSessionLayer()
+
+        routedAttributes = []
+        def countingRouter(context, routingData):
+            routedAttributes.append(context.get('attribute'))
+            routeVisibilityAttribute(context, routingData)
+
+        usdUfe.enableEditRouterCache(True)
+        try:
+            self.assertTrue(usdUfe.isEditRouterCacheEnabled())
+            mayaUsd.lib.registerEditRouter('attribute', countingRouter)
+
+            attrs = ufe.Attributes.attributes(self.b)
+            visibilityAttr = attrs.attribute(UsdGeom.Tokens.visibility)
+            visibilityAttr.set(UsdGeom.Tokens.invisible)
+            nbRouted = len(routedAttributes)
+            self.assertGreater(nbRouted, 0)
+            self.assertEqual(usdUfe.getEditRouterCacheStats().misses, nbRouted)
+
+            # The second edit is routed to the session layer from the cache.
+            visibilityAttr.set(UsdGeom.Tokens.inherited)
+            self.assertEqual(len(routedAttributes), nbRouted)
+            self.assertGreater(usdUfe.getEditRouterCacheStats().hits, 0)
+            self.assertEqual(sessionLayer.GetAttributeAtPath('/B.visibility').default,
+                             UsdGeom.Tokens.inherited)
+
+            # Changing the edit target invalidates the cache.
+            stage.SetEditTarget(sessionLayer)
+            visibilityAttr.set(UsdGeom.Tokens.invisible)
+            self.assertGreater(len(routedAttributes), nbRouted)
+
+            # So does registering an edit router.
+            nbRouted = len(routedAttributes)
+            mayaUsd.lib.registerEditRouter('attribute', countingRouter)
+            visibilityAttr.set(UsdGeom.Tokens.inherited)
+            self.assertGreater(len(routedAttributes), nbRouted)
+
+            usdUfe.clearEditRouterCache()
+            self.assertEqual(usdUfe.getEditRouterCacheStats().hits, 0)
+            self.assertEqual(usdUfe.getEditRouterCacheStats().misses, 0)
+        finally:
+            usdUfe.enableEditRouterCache(False)
+
     def _verifyEditRouterPreventingCmd(self, operationName, cmdFunc, verifyFunc):
         '''
         Test that an edit router can prevent a command for the given operation name,
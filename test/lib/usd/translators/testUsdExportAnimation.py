@@ -22,7 +22,7 @@ import unittest
 import fixturesUtils
 from maya import cmds
 from maya import standalone
-from pxr import Usd
+from pxr import Gf, Usd, UsdGeom
 
 
 class testUsdExportAnimation(unittest.TestCase):
@@ -105,3 +105,55 @@ class testUsdExportAnimation(unittest.TestCase):
         # Make sure value is there because previous code did not write any:
         self.assertEqual(attr.Get(), [20.0, 40.0])
 
+
+    def testExportContextEvaluation(self):
+        """Evaluating frames through a context writes the same samples as
+           changing the current time, and leaves the current time alone."""
+        cmds.file(new=True, force=True)
+        root = cmds.group(empty=True, name="root")
+        cube, _ = cmds.polyCube(name="Cube")
+        joint = cmds.joint()
+        cmds.parent(cube, joint, root)
+        cmds.skinCluster(joint, cube)
+        cmds.setKeyframe(joint, v=0, at='translateY', time=1)
+        cmds.setKeyframe(joint, v=5, at='translateY', time=10)
+        cmds.setKeyframe(root, v=0, at='rotateX', time=1)
+        cmds.setKeyframe(root, v=90, at='rotateX', time=10)
+        cmds.currentTime(3)
+
+        layers = []
+        for state in (False, True):
+            path = os.path.join(self.temp_dir, "contextEvaluation{}.usda".format("On" if state else "Off"))
+            cmds.mayaUSDExport(f=path, exportSkels="auto", frameRange=(1, 10), contextEvaluation=state)
+            self.assertEqual(cmds.currentTime(query=True), 3)
+
+            stage = Usd.Stage.Open(path)
+            layers.append(stage.GetRootLayer().ExportToString())
+
+        self.assertEqual(layers[0], layers[1])
+
+    def testExportContextEvaluationDeformedMesh(self):
+        """Evaluating frames through a context writes the deformed points of each
+           frame for a mesh deformed by a non-skinning deformer."""
+        cmds.file(new=True, force=True)
+        cube, _ = cmds.polyCube(name="Cube")
+        _, clusterHandle = cmds.cluster(cube + '.vtx[2:5]')
+        cmds.setKeyframe(clusterHandle, v=0, at='translateY', time=1)
+        cmds.setKeyframe(clusterHandle, v=5, at='translateY', time=10)
+        cmds.currentTime(3)
+
+        path = os.path.join(self.temp_dir, "contextEvaluationDeformedMesh.usda")
+        cmds.mayaUSDExport(f=path, frameRange=(1, 10), contextEvaluation=True)
+        self.assertEqual(cmds.currentTime(query=True), 3)
+
+        stage = Usd.Stage.Open(path)
+        points = UsdGeom.Mesh(stage.GetPrimAtPath("/Cube")).GetPointsAttr()
+        self.assertEqual(points.GetTimeSamples(), [float(t) for t in range(1, 11)])
+
+        for frame in range(1, 11):
+            cmds.currentTime(frame)
+            framePoints = points.Get(frame)
+            for i in range(8):
+                expected = cmds.xform(
+                    cube + '.vtx[%d]' % i, query=True, translation=True, objectSpace=True)
+                self.assertTrue(Gf.IsClose(framePoints[i], Gf.Vec3f(*expected), 1e-5))
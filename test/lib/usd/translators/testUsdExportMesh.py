@@ -16,6 +16,7 @@
 #
 
 import os
+import time
 import unittest
 
 from maya import cmds
@@ -187,6 +188,37 @@ class testUsdExportMesh(unittest.TestCase):
 
 
 
+    def testExportImportLargeMeshPrimvars(self):
+        """Benchmark UV and color set round-trip on a 2M face-vertex mesh."""
+        cmds.file(new=True, force=True)
+        mesh = cmds.polyPlane(name='LargePlane', sx=1000, sy=500)[0]
+        cmds.polyColorSet(mesh, create=True, colorSet='largeColors', representation='RGBA')
+        cmds.polyColorSet(mesh, currentColorSet=True, colorSet='largeColors')
+        cmds.polyColorPerVertex(mesh, rgb=(0.25, 0.5, 0.75), a=1.0)
+        self.assertEqual(cmds.polyEvaluate(mesh, face=True) * 4, 2000000)
+
+        usdFile = os.path.abspath('UsdExportMesh_largePrimvars.usda')
+        start = time.time()
+        cmds.mayaUSDExport(mergeTransformAndShape=True, file=usdFile, shadingMode='none',
+            exportColorSets=True, exportUVs=True)
+        print("Exported 2M face-vertex primvars in %.3f seconds" % (time.time() - start))
+
+        stage = Usd.Stage.Open(usdFile)
+        primvarsAPI = UsdGeom.PrimvarsAPI(stage.GetPrimAtPath('/LargePlane'))
+        st = primvarsAPI.GetPrimvar('st')
+        self.assertEqual(st.GetInterpolation(), UsdGeom.Tokens.faceVarying)
+        self.assertEqual(len(st.GetIndices()), 2000000)
+        colors = primvarsAPI.GetPrimvar('largeColors')
+        self.assertEqual(colors.GetInterpolation(), UsdGeom.Tokens.constant)
+
+        cmds.file(new=True, force=True)
+        start = time.time()
+        cmds.mayaUSDImport(file=usdFile)
+        print("Imported 2M face-vertex primvars in %.3f seconds" % (time.time() - start))
+
+        self.assertEqual(cmds.polyEvaluate('LargePlane', uvcoord=True), 501 * 1001)
+        self.assertIn('largeColors', cmds.polyColorSet('LargePlane', query=True, allColorSets=True))
+
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
@@ -20,6 +20,7 @@ import unittest
 from maya import cmds
 from maya import standalone
 from maya.api import OpenMaya as OM
+from maya.api import OpenMayaAnim as OMA
 
 from pxr import Gf, Sdf, Tf, Usd, UsdGeom, UsdSkel, UsdUtils, Vt
 
@@ -56,6 +57,120 @@ class TestUsdExportSkin(unittest.TestCase):
         grp = build_scene()
         self.assertRaises(RuntimeError, cmds.mayaUSDExport, file="Does_not_export.usdc", skn="auto", skl="auto")
 
+    def _buildSkinnedPlane(self, numJoints, subdivisions):
+        """Bind a plane along a chain of joints, with up to numJoints influences per point"""
+        cmds.file(f=1, new=1)
+        root = cmds.joint(p=(0, 0, 0))
+        for joint in range(1, numJoints):
+            cmds.joint(p=(0, 2 * joint, 0))
+        height = 2 * (numJoints - 1)
+        plane = cmds.polyPlane(
+            w=4, h=height, sx=subdivisions, sy=subdivisions, ax=(1, 0, 0))
+        cmds.move(0, height / 2.0, 0, plane[0])
+        cmds.select(root, add=1)
+        cmds.group()
+        cmds.skinCluster(
+            root, plane[0], maximumInfluences=numJoints, normalizeWeights=1, dropoffRate=0.1)
+        return plane[0]
+
+    def _exportInfluences(self, fileName, **kwargs):
+        """Export the skinned scene and return the element size, joint indices and joint
+        weights of its mesh"""
+        filePath = os.path.abspath(fileName)
+        cmds.mayaUSDExport(file=filePath, skn="auto", skl="auto", **kwargs)
+        stage = Usd.Stage.Open(filePath)
+        mesh = [prim for prim in stage.Traverse() if prim.IsA(UsdGeom.Mesh)][0]
+        binding = UsdSkel.BindingAPI(mesh)
+        weights = binding.GetJointWeightsPrimvar()
+        indices = binding.GetJointIndicesPrimvar()
+        self.assertEqual(indices.GetElementSize(), weights.GetElementSize())
+        return weights.GetElementSize(), list(indices.Get()), list(weights.Get())
+
+    @staticmethod
+    def _pointInfluences(size, indices, weights, point):
+        """Return the non-zero influences of a point, as a joint index to weight dict"""
+        return {
+            indices[i]: weights[i]
+            for i in range(point * size, (point + 1) * size) if weights[i] != 0.0 }
+
+    def _checkLargestInfluences(self, allExport, limitedExport, maxInfluences):
+        """Check that the limited export keeps the largest influences of each point, scaled
+        so that their sum is unchanged"""
+        allSize, allIndices, allWeights = allExport
+        size, indices, weights = limitedExport
+        self.assertEqual(size, min(allSize, maxInfluences))
+        self.assertEqual(len(weights) * allSize, len(allWeights) * size)
+
+        for point in range(len(weights) // size):
+            allInfluences = self._pointInfluences(allSize, allIndices, allWeights, point)
+            influences = self._pointInfluences(size, indices, weights, point)
+            self.assertEqual(len(influences), min(len(allInfluences), maxInfluences))
+            self.assertAlmostEqual(
+                sum(influences.values()), sum(allInfluences.values()), places=5)
+
+            # The kept joints are a subset of the original ones, and none of the dropped
+            # joints has a larger weight than a kept one.
+            self.assertTrue(set(influences).issubset(allInfluences))
+            dropped = [w for joint, w in allInfluences.items() if joint not in influences]
+            if dropped:
+                smallestKept = min(allInfluences[joint] for joint in influences)
+                self.assertGreaterEqual(smallestKept, max(dropped) - 1e-6)
+
+    def test_exportSkinMaxJointInfluences(self):
+        """Only keep the largest influences of each point, with their sum unchanged"""
+        self._buildSkinnedPlane(numJoints=5, subdivisions=8)
+
+        allExport = self._exportInfluences("AllInfluences.usda")
+        self.assertGreater(allExport[0], 3)
+
+        oneExport = self._exportInfluences("OneInfluence.usda", maxJointInfluences=1)
+        self._checkLargestInfluences(allExport, oneExport, 1)
+
+        threeExport = self._exportInfluences("ThreeInfluences.usda", maxJointInfluences=3)
+        self._checkLargestInfluences(allExport, threeExport, 3)
+
+        # Zero keeps all the influences.
+        noLimitExport = self._exportInfluences("NoLimit.usda", maxJointInfluences=0)
+        self.assertEqual(noLimitExport, allExport)
+
+    def test_exportSkinWeightsChunks(self):
+        """Export the weights of a mesh spanning several skin weight chunks"""
+        numJoints = 5
+        plane = self._buildSkinnedPlane(numJoints=numJoints, subdivisions=500)
+
+        # The weights are read by chunks of 2^20 weights, make sure there are several.
+        selection = OM.MSelectionList()
+        selection.add(plane)
+        meshPath = selection.getDagPath(0).extendToShape()
+        numVertices = OM.MFnMesh(meshPath).numVertices
+        self.assertGreater(numVertices * numJoints, 2 * (1 << 20))
+
+        # Read all the weights at once, as a reference for the chunked export.
+        selection.add(cmds.ls(type="skinCluster")[0])
+        skinCluster = OMA.MFnSkinCluster(selection.getDependNode(1))
+        components = OM.MFnSingleIndexedComponent()
+        componentsObj = components.create(OM.MFn.kMeshVertComponent)
+        components.setCompleteData(numVertices)
+        mayaWeights, numInfluences = skinCluster.getWeights(meshPath, componentsObj)
+        self.assertEqual(numInfluences, numJoints)
+
+        allExport = self._exportInfluences("ChunkedAllInfluences.usdc")
+        allSize, allIndices, allWeights = allExport
+        self.assertEqual(len(allWeights), numVertices * allSize)
+        self.assertGreater(allSize, 3)
+        for point in range(numVertices):
+            influences = self._pointInfluences(allSize, allIndices, allWeights, point)
+            mayaInfluences = {
+                joint: mayaWeights[point * numInfluences + joint]
+                for joint in range(numInfluences)
+                if abs(mayaWeights[point * numInfluences + joint]) > 1e-8 }
+            self.assertEqual(set(influences), set(mayaInfluences))
+            for joint, weight in influences.items():
+                self.assertAlmostEqual(weight, mayaInfluences[joint], places=5)
+
+        threeExport = self._exportInfluences(
+            "ChunkedThreeInfluences.usdc", maxJointInfluences=3)
+        self._checkLargestInfluences(allExport, threeExport, 3)
 
 if __name__ == '__main__':
     unittest.main(verbosity=2)
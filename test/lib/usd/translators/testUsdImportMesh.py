@@ -15,7 +15,7 @@
 # limitations under the License.
 #
 
-from pxr import UsdGeom
+from pxr import Usd, UsdGeom
 
 import mayaUsd.lib as mayaUsdLib
 
@@ -23,6 +23,7 @@ from maya import cmds
 from maya import standalone
 
 import os
+import tempfile
 import unittest
 
 import fixturesUtils
@@ -93,5 +94,33 @@ class testUsdImportMesh(unittest.TestCase):
     def testImportLeftHandedSubdiv(self):
         self.verifySubdivCommonAttributes('LeftHandedSubdivMeshShape')
 
+    def testImportManyMeshes(self):
+        '''The meshes are read in parallel before their Maya nodes are created.'''
+        tempDir = tempfile.mkdtemp(prefix='testUsdImportMesh')
+        stage = Usd.Stage.CreateNew(os.path.join(tempDir, 'ManyMeshes.usda'))
+        meshCount = 1000
+        for i in range(meshCount):
+            mesh = UsdGeom.Mesh.Define(stage, '/ManyMeshes/Quad_%d' % i)
+            mesh.CreatePointsAttr([(0, 0, i), (1, 0, i), (1, 1, i), (0, 1, i)])
+            mesh.CreateFaceVertexCountsAttr([4])
+            mesh.CreateFaceVertexIndicesAttr([0, 1, 2, 3])
+            if i % 2:
+                mesh.CreateOrientationAttr(UsdGeom.Tokens.leftHanded)
+        stage.Save()
+
+        cmds.usdImport(file=stage.GetRootLayer().realPath, shadingMode=[['none', 'default'], ])
+
+        for i in [0, 1, meshCount - 1]:
+            shape = 'Quad_%dShape' % i
+            self.assertTrue(cmds.objExists(shape))
+            position = cmds.xform(
+                shape + '.vtx[2]', query=True, translation=True, objectSpace=True)
+            self.assertEqual(position, [1.0, 1.0, float(i)])
+
+            # Left-handed faces have their vertices reversed.
+            faceVertices = cmds.polyInfo(shape + '.f[0]', faceToVertex=True)[0].split()[2:]
+            expected = ['3', '2', '1', '0'] if i % 2 else ['0', '1', '2', '3']
+            self.assertEqual(faceVertices, expected)
+
 if __name__ == '__main__':
     unittest.main(verbosity=2)
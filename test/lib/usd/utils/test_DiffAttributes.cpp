@@ -1,10 +1,15 @@
 #include <mayaUsdUtils/DiffPrims.h>
 
 #include <pxr/base/tf/type.h>
+#include <pxr/base/vt/array.h>
+#include <pxr/usd/sdf/layer.h>
 #include <pxr/usd/sdf/valueTypeName.h>
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 using namespace MayaUsdUtils;
 
@@ -414,3 +419,88 @@ TEST(DiffAttributes, compareAttributesCreatedSampledDouble)
     compareAttributes(modifiedAttr, baselineAttr, &quickDiff);
     EXPECT_NE(quickDiff, DiffResult::Same);
 }
+
+TEST(DiffAttributes, compareAttributesSameLayer)
+{
+    // Test that attributes resolved from the same layer are the same without reading their
+    // values, and that an override in one of the stages is still detected.
+    SdfPath primPath("/A");
+    SdfPath attrPath = primPath.AppendProperty(TfToken("test_attr"));
+    auto    doubleType = SdfValueTypeNames->Double;
+
+    auto layer = SdfLayer::CreateAnonymous();
+    {
+        auto stage = UsdStage::Open(layer);
+        auto prim = stage->DefinePrim(primPath);
+        auto attr = prim.CreateAttribute(attrPath.GetNameToken(), doubleType);
+        for (double time = 0.; time < 10.1; time += 1.0) {
+            attr.Set(1.0 * time, UsdTimeCode(time));
+        }
+    }
+
+    auto baselineStage = UsdStage::Open(layer, SdfLayerHandle());
+    auto baselineAttr = baselineStage->GetAttributeAtPath(attrPath);
+
+    auto modifiedStage = UsdStage::Open(layer, SdfLayerHandle());
+    auto modifiedAttr = modifiedStage->GetAttributeAtPath(attrPath);
+
+    EXPECT_EQ(compareAttributes(modifiedAttr, baselineAttr), DiffResult::Same);
+
+    auto overrideStage = UsdStage::Open(layer, SdfLayer::CreateAnonymous());
+    overrideStage->SetEditTarget(overrideStage->GetSessionLayer());
+    auto overrideAttr = overrideStage->GetAttributeAtPath(attrPath);
+    overrideAttr.Set(2.0, UsdTimeCode(5.0));
+
+    EXPECT_EQ(compareAttributes(overrideAttr, baselineAttr), DiffResult::Differ);
+
+    DiffResult quickDiff = DiffResult::Same;
+    compareAttributes(overrideAttr, baselineAttr, &quickDiff);
+    EXPECT_EQ(quickDiff, DiffResult::Differ);
+}
+
+TEST(DiffAttributes, compareAttributesSampledArraysTiming)
+{
+    // Time the comparison of an animated point attribute, as found on a deformed character.
+    SdfPath primPath("/A");
+    auto    pointsType = SdfValueTypeNames->Point3fArray;
+
+    auto baselineStage = UsdStage::CreateInMemory();
+    auto baselinePrim = baselineStage->DefinePrim(SdfPath(primPath));
+    auto baselineAttr = baselinePrim.CreateAttribute(TfToken("test_attr"), pointsType, true);
+
+    auto modifiedStage = UsdStage::CreateInMemory();
+    auto modifiedPrim = modifiedStage->DefinePrim(SdfPath(primPath));
+    auto modifiedAttr = modifiedPrim.CreateAttribute(TfToken("test_attr"), pointsType, true);
+
+    const size_t pointCount = 10000;
+    const int    frameCount = 200;
+    for (int frame = 0; frame < frameCount; ++frame) {
+        VtVec3fArray points(pointCount);
+        for (size_t i = 0; i < pointCount; ++i) {
+            points[i] = GfVec3f(float(i), float(frame), 0.f);
+        }
+        baselineAttr.Set(points, UsdTimeCode(frame));
+
+        // Values that are off by less than the tolerance are considered the same.
+        points[0][2] = 1e-9f;
+        modifiedAttr.Set(points, UsdTimeCode(frame));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(compareAttributes(modifiedAttr, baselineAttr), DiffResult::Same);
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "Compared " << frameCount << " samples of " << pointCount << " points in "
+              << duration.count() << " ms" << std::endl;
+
+    VtVec3fArray points;
+    modifiedAttr.Get(&points, UsdTimeCode(frameCount - 1));
+    points[pointCount - 1][0] += 1.f;
+    modifiedAttr.Set(points, UsdTimeCode(frameCount - 1));
+
+    EXPECT_EQ(compareAttributes(modifiedAttr, baselineAttr), DiffResult::Differ);
+
+    DiffResult quickDiff = DiffResult::Same;
+    compareAttributes(modifiedAttr, baselineAttr, &quickDiff);
+    EXPECT_EQ(quickDiff, DiffResult::Differ);
+}
@@ -5,6 +5,10 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <string>
+
 PXR_NAMESPACE_USING_DIRECTIVE
 using namespace MayaUsdUtils;
 
@@ -160,3 +164,62 @@ TEST(DiffPrimsChildren, comparePrimsChildrenCreated)
     comparePrimsChildren(modifiedPrim, baselinePrim, &quickDiff);
     EXPECT_NE(quickDiff, DiffResult::Same);
 }
+
+TEST(DiffPrimsChildren, comparePrimsChildrenQuickResults)
+{
+    // Test that the quick results stop at the first child that differs, in order.
+
+    const SdfPath childPath3("/A/D");
+
+    auto baselineStage = UsdStage::CreateInMemory();
+    auto baselinePrim = createPrim(baselineStage, primPath);
+    createChild(baselineStage, childPath1, 1.0);
+    createChild(baselineStage, childPath2, 1.0);
+    createChild(baselineStage, childPath3, 1.0);
+
+    auto modifiedStage = UsdStage::CreateInMemory();
+    auto modifiedPrim = createPrim(modifiedStage, primPath);
+    createChild(modifiedStage, childPath1, 1.0);
+    createChild(modifiedStage, childPath2, 2.0);
+    createChild(modifiedStage, childPath3, 2.0);
+
+    DiffResult        quickDiff = DiffResult::Same;
+    DiffResultPerPath results = comparePrimsChildren(modifiedPrim, baselinePrim, &quickDiff);
+    EXPECT_EQ(quickDiff, DiffResult::Differ);
+
+    EXPECT_EQ(results.size(), std::size_t(2));
+    EXPECT_EQ(results[childPath1], DiffResult::Same);
+    EXPECT_EQ(results[childPath2], DiffResult::Differ);
+}
+
+TEST(DiffPrimsChildren, comparePrimsChildrenTiming)
+{
+    // Time the comparison of a large hierarchy.
+
+    const int childCount = 100;
+
+    auto baselineStage = UsdStage::CreateInMemory();
+    auto baselinePrim = createPrim(baselineStage, primPath);
+
+    auto modifiedStage = UsdStage::CreateInMemory();
+    auto modifiedPrim = createPrim(modifiedStage, primPath);
+
+    for (int i = 0; i < childCount; ++i) {
+        const SdfPath childPath = primPath.AppendChild(TfToken("C" + std::to_string(i)));
+        for (int j = 0; j < childCount; ++j) {
+            const SdfPath grandChildPath = childPath.AppendChild(TfToken("G" + std::to_string(j)));
+            createChild(baselineStage, grandChildPath, i * j);
+            createChild(modifiedStage, grandChildPath, i * j);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    DiffResultPerPath results = comparePrimsChildren(modifiedPrim, baselinePrim);
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "Compared " << childCount * childCount << " prims in " << duration.count()
+              << " ms" << std::endl;
+
+    EXPECT_EQ(results.size(), std::size_t(childCount));
+    EXPECT_EQ(computeOverallResult(results), DiffResult::Same);
+}
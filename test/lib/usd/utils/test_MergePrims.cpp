@@ -1,5 +1,6 @@
 #include <mayaUsdUtils/MergePrims.h>
 
+#include <pxr/base/tf/stringUtils.h>
 #include <pxr/base/tf/token.h>
 #include <pxr/base/tf/type.h>
 #include <pxr/usd/sdf/path.h>
@@ -292,6 +293,73 @@ TEST(MergePrims, mergePrimsCreatedChild)
     EXPECT_EQ(value, 2.);
 }
 
+TEST(MergePrims, mergePrimsCreatedHierarchy)
+{
+    // Test that a whole hierarchy absent from the baseline is created, with its attributes,
+    // time samples and relationships.
+
+    auto baselineStage = UsdStage::CreateInMemory();
+    auto baselinePrim = createPrim(baselineStage, primPath);
+    createChild(baselineStage, childPath1, 1.0);
+
+    auto modifiedStage = UsdStage::CreateInMemory();
+    auto modifiedPrim = createPrim(modifiedStage, primPath);
+    createChild(modifiedStage, childPath1, 1.0);
+    auto modifiedChild2 = createChild(modifiedStage, childPath2, 2.0);
+    createRel(modifiedChild2, testRelName, targetPath1);
+
+    const size_t gridSize = 100;
+    for (size_t i = 0; i < gridSize; ++i) {
+        const TfToken grandChildName(TfStringPrintf("G%zu", i));
+        auto grandChild = createChild(modifiedStage, childPath2.AppendChild(grandChildName), 3.0);
+        auto animAttr = grandChild.CreateAttribute(otherAttrName, doubleType, true);
+        for (size_t frame = 0; frame < gridSize; ++frame)
+            animAttr.Set(double(frame), UsdTimeCode(double(frame)));
+    }
+
+    MergePrimsOptions options;
+    options.mergeChildren = true;
+    options.propertiesHandling = MergeMissing::Create;
+    options.verbosity = MergeVerbosity::Failure;
+
+    const bool result = mergePrims(
+        modifiedStage,
+        modifiedStage->GetRootLayer(),
+        modifiedPrim.GetPath(),
+        baselineStage,
+        baselineStage->GetRootLayer(),
+        baselinePrim.GetPath(),
+        options);
+
+    EXPECT_TRUE(result);
+
+    EXPECT_EQ(rangeSize(baselinePrim.GetChildren()), size_t(2));
+
+    double value = 0.;
+
+    auto baselineChild2 = baselineStage->GetPrimAtPath(childPath2);
+    EXPECT_TRUE(baselineChild2.IsValid());
+    EXPECT_EQ(baselineChild2.GetTypeName(), TfToken("xform"));
+    EXPECT_TRUE(baselineChild2.GetAttribute(testAttrName).Get(&value));
+    EXPECT_EQ(value, 2.);
+
+    SdfPathVector targets;
+    EXPECT_TRUE(baselineChild2.GetRelationship(testRelName).GetTargets(&targets));
+    EXPECT_EQ(targets, SdfPathVector({ targetPath1 }));
+
+    EXPECT_EQ(rangeSize(baselineChild2.GetChildren()), gridSize);
+    for (const UsdPrim& grandChild : baselineChild2.GetChildren()) {
+        EXPECT_EQ(grandChild.GetAuthoredAttributes().size(), size_t(2));
+        EXPECT_TRUE(grandChild.GetAttribute(testAttrName).Get(&value));
+        EXPECT_EQ(value, 3.);
+
+        auto animAttr = grandChild.GetAttribute(otherAttrName);
+        EXPECT_EQ(animAttr.GetNumTimeSamples(), gridSize);
+        EXPECT_TRUE(animAttr.Get(&value, UsdTimeCode(5.0)));
+        EXPECT_EQ(value, 5.);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /// Merging prim only: not merging children.
 